@@ -83,6 +83,16 @@ void BaseConnectionManager::initialize(int stage)
             sendDirect = false;
 
         maxInterferenceDistance = calcInterfDist();
+
+        // optionally, only connect nics within the near field and aggregate everything beyond
+        double nearFieldDist = hasPar("nearFieldDist") ? par("nearFieldDist").doubleValue() : 0;
+        if (nearFieldDist > 0 && nearFieldDist < maxInterferenceDistance) {
+            if (useTorus) throw cRuntimeError("Aggregated far-field interference (nearFieldDist > 0) is not supported on a torus playground");
+            farField = make_unique<FarFieldInterference>(nearFieldDist, maxInterferenceDistance, par("farFieldCellSize").doubleValue(), par("farFieldBinDuration"), par("farFieldHistory"), par("farFieldPathLossAlpha").doubleValue());
+            EV_TRACE << "connecting nics up to " << nearFieldDist << " m, aggregating interference up to " << maxInterferenceDistance << " m" << endl;
+            maxInterferenceDistance = nearFieldDist;
+        }
+
         maxDistSquared = maxInterferenceDistance * maxInterferenceDistance;
 
         // ----initialize node grid-----
@@ -28,6 +28,7 @@
 
 #include "veins/base/utils/AntennaPosition.h"
 #include "veins/base/connectionManager/NicEntry.h"
+#include "veins/base/connectionManager/FarFieldInterference.h"
 #include "veins/base/utils/Heading.h"
 
 namespace veins {
@@ -270,6 +271,9 @@ protected:
      * TkEnv.*/
     bool drawMIR;
 
+    /** @brief Aggregate of transmissions beyond the near-field distance, nullptr if nics are connected up to the maximum interference distance.*/
+    std::unique_ptr<FarFieldInterference> farField;
+
     /** @brief Type for 1-dimensional array of NicEntries.*/
     using RowVector = std::vector<NicEntries>;
     /** @brief Type for 2-dimensional array of NicEntries.*/
@@ -428,6 +432,12 @@ public:
 
     /** @brief Returns the ingate of the with id==targetID, or 0 if not in range*/
     const cGate* getOutGateTo(const NicEntry* nic, const NicEntry* targetNic) const;
+
+    /** @brief Returns the aggregate of far-field interference, or nullptr if disabled*/
+    FarFieldInterference* getFarFieldInterference() const
+    {
+        return farField.get();
+    }
 };
 
 } // namespace veins
@@ -86,28 +86,53 @@ void ChannelAccess::sendToChannel(cPacket* msg)
 
     const auto& gateList = cc->getGateList(getParentModule()->getId());
 
+    channelCopies.clear();
     for (auto&& entry : gateList) {
         const auto gate = entry.second;
         const auto propagationDelay = calculatePropagationDelay(entry.first);
 
-        if (useSendDirect) {
-            if (gate->isVector()) {
-                for (int gateIndex = gate->getBaseId(); gateIndex < gate->getBaseId() + gate->size(); gateIndex++) {
-                    sendDirect(msg->dup(), propagationDelay, msg->getDuration(), gate->getOwnerModule(), gateIndex);
-                }
-            }
-            else {
-                sendDirect(msg->dup(), propagationDelay, msg->getDuration(), gate->getOwnerModule(), gate->getBaseId());
+        if (useSendDirect && gate->isVector()) {
+            for (int gateIndex = gate->getBaseId(); gateIndex < gate->getBaseId() + gate->size(); gateIndex++) {
+                channelCopies.push_back({msg->dup(), entry.first, gate, gateIndex, propagationDelay});
             }
         }
         else {
-            sendDelayed(msg->dup(), propagationDelay, gate);
+            channelCopies.push_back({msg->dup(), entry.first, gate, gate->getBaseId(), propagationDelay});
+        }
+    }
+
+    prepareChannelCopies(channelCopies);
+
+    for (auto&& copy : channelCopies) {
+        if (useSendDirect) {
+            sendDirect(copy.msg, copy.propagationDelay, msg->getDuration(), copy.gate->getOwnerModule(), copy.gateId);
+        }
+        else {
+            sendDelayed(copy.msg, copy.propagationDelay, copy.gate);
         }
     }
+    channelCopies.clear();
+
     // Original message no longer needed, copies have been sent to all possible receivers.
     delete msg;
 }
 
+void ChannelAccess::recordFarFieldTransmission(double txPower_mW, double centerFrequency, simtime_t_cref duration)
+{
+    FarFieldInterference* farField = cc->getFarFieldInterference();
+    if (farField == nullptr) return;
+
+    farField->addTransmission(antennaPosition.getPositionAt(), txPower_mW, centerFrequency, simTime(), duration);
+}
+
+double ChannelAccess::getFarFieldInterferencePower(simtime_t_cref start, simtime_t_cref end, double centerFrequency) const
+{
+    FarFieldInterference* farField = cc->getFarFieldInterference();
+    if (farField == nullptr) return 0;
+
+    return farField->getInterference(antennaPosition.getPositionAt(), centerFrequency, start, end);
+}
+
 simtime_t ChannelAccess::calculatePropagationDelay(const NicEntry* nic)
 {
     if (!usePropagationDelay) return 0;
@@ -90,6 +90,18 @@ protected:
     /** @brief Offset of antenna orientation (yaw, in rad) with respect to what a BaseMobility module will tell us */
     double antennaOffsetYaw = 0;
 
+    /** @brief A copy of a message sent to the channel, for one gate of a receiving nic */
+    struct ChannelCopy {
+        cPacket* msg;
+        const NicEntry* nic;
+        cGate* gate;
+        int gateId;
+        simtime_t propagationDelay;
+    };
+
+    /** @brief Copies of the message currently sent by sendToChannel() */
+    std::vector<ChannelCopy> channelCopies;
+
 protected:
     /**
      * @brief Calculates the propagation delay to the passed receiving nic.
@@ -107,6 +119,31 @@ protected:
      **/
     void sendToChannel(cPacket* msg);
 
+    /**
+     * @brief Called by sendToChannel() with the copies for all receiving nics right before they are sent.
+     *
+     * Does nothing by default.
+     * Physical layers can override this to process all copies at once, e.g., in parallel.
+     */
+    virtual void prepareChannelCopies(std::vector<ChannelCopy>& copies)
+    {
+    }
+
+    /**
+     * @brief Accounts a transmission starting now in the far-field interference aggregate.
+     *
+     * Does nothing unless the ConnectionManager aggregates far-field interference (see its nearFieldDist parameter).
+     * Physical layers call this for every frame passed to sendToChannel().
+     */
+    void recordFarFieldTransmission(double txPower_mW, double centerFrequency, simtime_t_cref duration);
+
+    /**
+     * @brief Returns the mean far-field interference power (in mW) at this nic during [start, end].
+     *
+     * Returns 0 unless the ConnectionManager aggregates far-field interference (see its nearFieldDist parameter).
+     */
+    double getFarFieldInterferencePower(simtime_t_cref start, simtime_t_cref end, double centerFrequency) const;
+
 public:
     /**
      * @brief Returns a pointer to the ConnectionManager responsible for the
@@ -0,0 +1,179 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/base/connectionManager/FarFieldInterference.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "veins/base/modules/BaseWorldUtility.h"
+
+using namespace veins;
+
+FarFieldInterference::FarFieldInterference(double nearFieldDistance, double maxDistance, double cellSize, simtime_t binDuration, simtime_t history, double pathLossAlpha)
+    : nearFieldDistance(nearFieldDistance)
+    , maxDistance(maxDistance)
+    , cellSize(cellSize)
+    , binDuration(binDuration.dbl())
+    , history(history.dbl())
+    , pathLossAlpha(pathLossAlpha)
+{
+    if (cellSize <= 0) throw cRuntimeError("FarFieldInterference: cell size must be positive");
+    if (binDuration <= 0) throw cRuntimeError("FarFieldInterference: bin duration must be positive");
+    if (history < 0) throw cRuntimeError("FarFieldInterference: history must not be negative");
+    cellsPerBlock = std::max(1, static_cast<int>(nearFieldDistance / cellSize / 2));
+}
+
+int64_t FarFieldInterference::binOf(double time) const
+{
+    return static_cast<int64_t>(std::floor(time / binDuration));
+}
+
+namespace {
+
+int floorDiv(int a, int b)
+{
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+}
+
+} // namespace
+
+void FarFieldInterference::addTransmission(const Coord& pos, double txPower_mW, double centerFrequency, simtime_t_cref start, simtime_t_cref duration)
+{
+    const double t0 = start.dbl();
+    const double t1 = (start + duration).dbl();
+
+    if (t0 - lastPrune > history) {
+        prune(t0 - history);
+        lastPrune = t0;
+    }
+
+    // free space loss at 1 m; the remaining distance dependence is applied per receiver
+    const double wavelength = BaseWorldUtility::speedOfLight() / centerFrequency;
+    const double power1m = txPower_mW * wavelength * wavelength / (16 * M_PI * M_PI);
+
+    const Index cell(static_cast<int>(std::floor(pos.x / cellSize)), static_cast<int>(std::floor(pos.y / cellSize)));
+    const Index block(floorDiv(cell.first, cellsPerBlock), floorDiv(cell.second, cellsPerBlock));
+    Bins& bins = channels[centerFrequency][block][cell];
+    for (int64_t bin = binOf(t0); bin <= binOf(t1); ++bin) {
+        const double overlap = std::min(t1, (bin + 1) * binDuration) - std::max(t0, bin * binDuration);
+        if (overlap > 0) bins[bin] += power1m * overlap;
+    }
+}
+
+double FarFieldInterference::getInterference(const Coord& pos, double centerFrequency, simtime_t_cref start, simtime_t_cref end) const
+{
+    auto channel = channels.find(centerFrequency);
+    if (channel == channels.end()) return 0;
+    const Blocks& blocks = channel->second;
+
+    const double t0 = start.dbl();
+    const double t1 = end.dbl();
+    const int64_t firstBin = binOf(t0);
+    const int64_t lastBin = binOf(t1);
+
+    double interference = 0;
+
+    // visit the blocks around pos that may lie within maxDistance, unless there are fewer blocks with transmissions altogether
+    const double blockSize = cellsPerBlock * cellSize;
+    const double minX = std::floor((pos.x - maxDistance) / blockSize);
+    const double maxX = std::floor((pos.x + maxDistance) / blockSize);
+    const double minY = std::floor((pos.y - maxDistance) / blockSize);
+    const double maxY = std::floor((pos.y + maxDistance) / blockSize);
+    const double windowBlocks = (maxX - minX + 1) * (maxY - minY + 1);
+    if (windowBlocks < blocks.size()) {
+        for (int x = static_cast<int>(minX); x <= static_cast<int>(maxX); ++x) {
+            for (int y = static_cast<int>(minY); y <= static_cast<int>(maxY); ++y) {
+                auto block = blocks.find(Index(x, y));
+                if (block == blocks.end()) continue;
+                addBlockInterference(block->first, block->second, pos, t0, t1, firstBin, lastBin, interference);
+            }
+        }
+    }
+    else {
+        for (const auto& block : blocks) {
+            addBlockInterference(block.first, block.second, pos, t0, t1, firstBin, lastBin, interference);
+        }
+    }
+    return interference;
+}
+
+void FarFieldInterference::addBlockInterference(const Index& block, const Cells& blockCells, const Coord& pos, double t0, double t1, int64_t firstBin, int64_t lastBin, double& interference) const
+{
+    const double nearSquared = nearFieldDistance * nearFieldDistance;
+    const double maxSquared = maxDistance * maxDistance;
+
+    // skip blocks whose cell centers all lie within the near field or all lie beyond maxDistance
+    const double blockSize = cellsPerBlock * cellSize;
+    const double x1 = block.first * blockSize + cellSize / 2 - pos.x;
+    const double x2 = (block.first + 1) * blockSize - cellSize / 2 - pos.x;
+    const double y1 = block.second * blockSize + cellSize / 2 - pos.y;
+    const double y2 = (block.second + 1) * blockSize - cellSize / 2 - pos.y;
+    const double nearestX = (x1 > 0) ? x1 : ((x2 < 0) ? x2 : 0);
+    const double nearestY = (y1 > 0) ? y1 : ((y2 < 0) ? y2 : 0);
+    const double farthestX = std::max(std::abs(x1), std::abs(x2));
+    const double farthestY = std::max(std::abs(y1), std::abs(y2));
+    if (farthestX * farthestX + farthestY * farthestY <= nearSquared) return;
+    if (nearestX * nearestX + nearestY * nearestY > maxSquared) return;
+
+    for (const auto& cell : blockCells) {
+        const double dx = (cell.first.first + 0.5) * cellSize - pos.x;
+        const double dy = (cell.first.second + 0.5) * cellSize - pos.y;
+        const double distSquared = dx * dx + dy * dy;
+        if (distSquared <= nearSquared || distSquared > maxSquared) continue;
+
+        // mean transmit power (at 1 m) of the cell during [start, end]
+        double power1m = 0;
+        const Bins& bins = cell.second;
+        for (auto it = bins.lower_bound(firstBin); it != bins.end() && it->first <= lastBin; ++it) {
+            if (t1 > t0) {
+                const double overlap = std::min(t1, (it->first + 1) * binDuration) - std::max(t0, it->first * binDuration);
+                power1m += it->second / binDuration * overlap / (t1 - t0);
+            }
+            else {
+                power1m += it->second / binDuration;
+            }
+        }
+        if (power1m == 0) continue;
+
+        interference += power1m * std::pow(distSquared, -pathLossAlpha / 2);
+    }
+}
+
+void FarFieldInterference::prune(double time)
+{
+    const int64_t firstKept = binOf(time);
+    for (auto channel = channels.begin(); channel != channels.end();) {
+        Blocks& blocks = channel->second;
+        for (auto block = blocks.begin(); block != blocks.end();) {
+            Cells& cells = block->second;
+            for (auto cell = cells.begin(); cell != cells.end();) {
+                Bins& bins = cell->second;
+                bins.erase(bins.begin(), bins.lower_bound(firstKept));
+                cell = bins.empty() ? cells.erase(cell) : std::next(cell);
+            }
+            block = cells.empty() ? blocks.erase(block) : std::next(block);
+        }
+        channel = blocks.empty() ? channels.erase(channel) : std::next(channel);
+    }
+}
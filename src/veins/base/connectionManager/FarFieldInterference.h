@@ -0,0 +1,118 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "veins/veins.h"
+
+#include "veins/base/utils/Coord.h"
+
+namespace veins {
+
+/**
+ * @brief Aggregate of the interference caused by distant transmissions.
+ *
+ * Transmissions are accounted per square cell of the x-y plane, per center frequency and per time bin.
+ * Each cell stores the energy of its transmissions as it would be received 1 m away in free space.
+ * A receiver then treats all cells farther away than the near-field distance as point sources at their center
+ * whose power decays with distance^-alpha.
+ *
+ * Used by BaseConnectionManager to replace the AirFrames of far-away transmitters by a single noise term
+ * (see the nearFieldDist parameter of ConnectionManager).
+ *
+ * Cells are grouped into square blocks of about half the near-field distance.
+ * A receiver only visits blocks that are neither entirely within its near field nor entirely beyond the maximum distance
+ * (looking them up in the window around it whenever this is cheaper than visiting all blocks with transmissions),
+ * so its cost grows with the number of cells at far-field distance rather than with the size of the map.
+ *
+ * As the aggregate does not know individual transmitters, transmitters close to the near-field distance
+ * may be counted either twice or not at all, depending on the position of their cell center.
+ * Choose the cell size small compared to the near-field distance to keep this error small.
+ *
+ * @ingroup connectionManager
+ */
+class VEINS_API FarFieldInterference {
+public:
+    /**
+     * @param nearFieldDistance cells closer to a receiver than this are ignored (in m)
+     * @param maxDistance cells farther away from a receiver than this are ignored (in m)
+     * @param cellSize edge length of the cells (in m)
+     * @param binDuration length of the time bins
+     * @param history how long bins are kept after they ended; must exceed the longest frame
+     * @param pathLossAlpha path loss exponent used from the cell center to the receiver
+     */
+    FarFieldInterference(double nearFieldDistance, double maxDistance, double cellSize, simtime_t binDuration, simtime_t history, double pathLossAlpha);
+
+    /**
+     * @brief Accounts a transmission starting at start and lasting for duration.
+     */
+    void addTransmission(const Coord& pos, double txPower_mW, double centerFrequency, simtime_t_cref start, simtime_t_cref duration);
+
+    /**
+     * @brief Returns the mean far-field interference power (in mW) at pos during [start, end].
+     *
+     * If start equals end, returns the power of the bin containing start.
+     */
+    double getInterference(const Coord& pos, double centerFrequency, simtime_t_cref start, simtime_t_cref end) const;
+
+    double getNearFieldDistance() const
+    {
+        return nearFieldDistance;
+    }
+
+private:
+    /** @brief x and y index of a cell or block */
+    using Index = std::pair<int, int>;
+    /** @brief energy at 1 m (in mW*s) per time bin index */
+    using Bins = std::map<int64_t, double>;
+    /** @brief bins of each cell with transmissions */
+    using Cells = std::map<Index, Bins>;
+    /** @brief cells of each block with transmissions */
+    using Blocks = std::map<Index, Cells>;
+
+    /** @brief removes all bins which ended before time */
+    void prune(double time);
+
+    int64_t binOf(double time) const;
+
+    /** @brief adds the interference (in mW) caused by the cells of one block at pos during bins [firstBin, lastBin] to interference */
+    void addBlockInterference(const Index& block, const Cells& blockCells, const Coord& pos, double t0, double t1, int64_t firstBin, int64_t lastBin, double& interference) const;
+
+    double nearFieldDistance;
+    double maxDistance;
+    double cellSize;
+    double binDuration;
+    double history;
+    double pathLossAlpha;
+    int cellsPerBlock; /**< edge length of blocks, in cells */
+
+    /** @brief time of the last call to prune, in s */
+    double lastPrune = 0;
+
+    /** @brief blocks with transmissions, per center frequency */
+    std::map<double, Blocks> channels;
+};
+
+} // namespace veins
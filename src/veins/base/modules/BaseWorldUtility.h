@@ -26,9 +26,13 @@
 
 #pragma once
 
+#include <memory>
+
 #include "veins/veins.h"
 
 #include "veins/base/utils/Coord.h"
+#include "veins/base/phyLayer/PhyConfigurationCache.h"
+#include "veins/base/utils/ThreadPool.h"
 
 namespace veins {
 
@@ -60,6 +64,12 @@ protected:
     /** @brief Stores if members are already initialized. */
     bool isInitialized;
 
+    /** @brief PHY configuration parsed from XML, shared by all PHYs of this simulation */
+    PhyConfigurationCache phyConfigurationCache;
+
+    /** @brief Worker threads shared by all modules of this simulation, created on first use */
+    std::unique_ptr<ThreadPool> threadPool;
+
 public:
     /** @brief Speed of light in meters per second. */
     static const double speedOfLight()
@@ -124,6 +134,21 @@ public:
 
         return airFrameId++;
     }
+
+    /** @brief Returns the cache of PHY configuration shared by all PHYs of this simulation */
+    PhyConfigurationCache& getPhyConfigurationCache()
+    {
+        return phyConfigurationCache;
+    }
+
+    /** @brief Returns the worker threads shared by all modules of this simulation */
+    ThreadPool& getThreadPool()
+    {
+        if (!threadPool) {
+            threadPool = make_unique<ThreadPool>(par("numThreads").intValue());
+        }
+        return *threadPool;
+    }
 };
 
 } // namespace veins
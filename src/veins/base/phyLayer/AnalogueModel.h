@@ -38,6 +38,37 @@ namespace veins {
 class AirFrame;
 class Signal;
 
+/**
+ * @brief Attenuation of one link by one analogue model, computed without touching the Signal's values.
+ *
+ * Value i of the Signal is to be multiplied by perFrequency[i] * factor, or by factor only if perFrequency is nullptr.
+ * Used by models that can be fused into a StaticAnalogueModelChain.
+ *
+ * @ingroup analogueModels
+ */
+struct VEINS_API LinkAttenuation {
+    const double* perFrequency = nullptr; ///< one factor per frequency of the Signal (owned by the model), or nullptr
+    double factor = 1; ///< factor common to all frequencies
+
+    /**
+     * Multiply this attenuation into the passed value of frequency index i.
+     */
+    double applyTo(double value, size_t i) const
+    {
+        return value * (perFrequency ? perFrequency[i] * factor : factor);
+    }
+
+    /**
+     * Multiply this attenuation into all numValues values.
+     */
+    void applyTo(double* values, size_t numValues) const
+    {
+        for (size_t i = 0; i < numValues; i++) {
+            values[i] = applyTo(values[i], i);
+        }
+    }
+};
+
 /**
  * @brief Interface for the analogue models of the physical layer.
  *
@@ -77,8 +108,71 @@ public:
     {
         return false;
     }
+
+    /**
+     * If the model keeps no per-node state (i.e., filterSignal only depends on the Signal and on immutable configuration), it returns true here.
+     * This allows a single instance to be shared by all PHYs configured with the same XML element.
+     *
+     * Random numbers drawn via RNGCONTEXT still come from the receiving PHY, so they do not constitute per-node state of the model.
+     */
+    virtual bool isStateless()
+    {
+        return false;
+    }
+
+    /**
+     * If filterSignal multiplies each value of a signal by a factor that only depends on the spectrum, the POAs of sender and receiver, and immutable configuration, it returns true here.
+     * That is, it neither depends on time, nor on random numbers, nor on other hosts.
+     * Static parts of the environment (e.g., buildings) count as immutable configuration, as long as the model reports their changes via getGeneration.
+     *
+     * This allows caching its attenuation per link (see BasePhyLayer parameter cacheLinkBudgets).
+     */
+    virtual bool isDeterministic()
+    {
+        return false;
+    }
+
+    /**
+     * For deterministic models (see isDeterministic), a counter that increases whenever the environment their attenuation depends on changes at runtime (e.g., when buildings are added or removed).
+     *
+     * Attenuation cached at another generation is stale.
+     */
+    virtual uint64_t getGeneration()
+    {
+        return 0;
+    }
+
+    /**
+     * If filterSignal may be called for different Signals concurrently (see BasePhyLayer parameter parallelAnalogueModels), it returns true here.
+     *
+     * Such models must draw random numbers from Signal::getRandomStream(), which is always present on Signals filtered concurrently.
+     * Any lazily built caches must be filled in prepareConcurrentFiltering.
+     */
+    virtual bool isThreadSafe()
+    {
+        return false;
+    }
+
+    /**
+     * Called on the simulation thread for each Signal before filterSignal is called for several Signals concurrently.
+     *
+     * Only called if isThreadSafe() returns true.
+     */
+    virtual void prepareConcurrentFiltering(const Signal& signal)
+    {
+    }
+
+    /**
+     * Change the component this model logs on behalf of.
+     *
+     * Shared models are handed over to a module that outlives all PHYs using them.
+     */
+    virtual void setOwner(cComponent* newOwner)
+    {
+        owner = newOwner;
+    }
 };
 
-using AnalogueModelList = std::vector<std::unique_ptr<AnalogueModel>>;
+using AnalogueModelList = std::vector<std::shared_ptr<AnalogueModel>>;
 
 } // namespace veins
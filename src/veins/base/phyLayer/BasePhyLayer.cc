@@ -24,6 +24,7 @@
 
 #include "veins/base/phyLayer/BasePhyLayer.h"
 
+#include <iomanip>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -32,9 +33,13 @@
 #include "veins/base/utils/POA.h"
 #include "veins/modules/phy/SampledAntenna1D.h"
 #include "veins/base/phyLayer/AnalogueModel.h"
+#include "veins/base/phyLayer/PhyConfigurationCache.h"
 #include "veins/base/phyLayer/Decider.h"
 #include "veins/base/modules/BaseWorldUtility.h"
 #include "veins/base/connectionManager/BaseConnectionManager.h"
+#include "veins/base/connectionManager/NicEntry.h"
+#include "veins/base/utils/CounterRng.h"
+#include "veins/base/utils/ThreadPool.h"
 
 using namespace veins;
 
@@ -106,6 +111,22 @@ void BasePhyLayer::initialize(int stage)
         initializeDecider(par("decider").xmlValue());
         initializeAntenna(par("antenna").xmlValue());
 
+        parallelAnalogueModels = par("parallelAnalogueModels").boolValue();
+        if (parallelAnalogueModels) {
+            cRNG* rng = getRNG(0);
+            randomStreamSeed = (static_cast<uint64_t>(rng->intRand()) << 32) | rng->intRand();
+        }
+
+        cacheLinkBudgets = par("cacheLinkBudgets").boolValue();
+        numCachedAnalogueModels = 0;
+        if (cacheLinkBudgets) {
+            // when sending, only thread-safe models may be evaluated
+            size_t maxCachedAnalogueModels = parallelAnalogueModels ? numThreadSafeAnalogueModels : analogueModels.size();
+            while (numCachedAnalogueModels < maxCachedAnalogueModels && analogueModels[numCachedAnalogueModels]->isDeterministic()) {
+                numCachedAnalogueModels++;
+            }
+        }
+
         radioSwitchingOverTimer = new cMessage("radio switching over", RADIO_SWITCHING_OVER);
         txOverTimer = new cMessage("transmission over", TX_OVER);
     }
@@ -142,40 +163,7 @@ unique_ptr<Radio> BasePhyLayer::initializeRadio()
 
 void BasePhyLayer::getParametersFromXML(cXMLElement* xmlData, ParameterMap& outputMap)
 {
-    cXMLElementList parameters = xmlData->getElementsByTagName("Parameter");
-
-    for (cXMLElementList::const_iterator it = parameters.begin(); it != parameters.end(); it++) {
-
-        const char* name = (*it)->getAttribute("name");
-        const char* type = (*it)->getAttribute("type");
-        const char* value = (*it)->getAttribute("value");
-        if (name == nullptr || type == nullptr || value == nullptr) throw cRuntimeError("Invalid parameter, could not find name, type or value");
-
-        std::string sType = type; // needed for easier comparision
-        std::string sValue = value; // needed for easier comparision
-
-        cMsgPar param(name);
-
-        // parse type of parameter and set value
-        if (sType == "bool") {
-            param.setBoolValue(sValue == "true" || sValue == "1");
-        }
-        else if (sType == "double") {
-            param.setDoubleValue(strtod(value, nullptr));
-        }
-        else if (sType == "string") {
-            param.setStringValue(value);
-        }
-        else if (sType == "long") {
-            param.setLongValue(strtol(value, nullptr, 0));
-        }
-        else {
-            throw cRuntimeError("Unknown parameter type: '%s'", sType.c_str());
-        }
-
-        // add parameter to output map
-        outputMap[name] = param;
-    }
+    outputMap = world->getPhyConfigurationCache().getParameters(xmlData);
 }
 
 void BasePhyLayer::finish()
@@ -184,6 +172,11 @@ void BasePhyLayer::finish()
     if (decider != nullptr) {
         decider->finish();
     }
+
+    if (cacheLinkBudgets && recordStats) {
+        recordScalar("linkBudgetHits", linkBudgetHits);
+        recordScalar("linkBudgetMisses", linkBudgetMisses);
+    }
 }
 
 // -----Decider initialization----------------------
@@ -275,13 +268,39 @@ void BasePhyLayer::initializeAntenna(cXMLElement* xmlConfig)
     EV_TRACE << "Antenna \"" << name << "\" with ID \"" << id << "\" loaded." << endl;
 }
 
+namespace {
+
+/**
+ * Returns the process-wide registry of immutable antennas, keyed by their configuration.
+ *
+ * Only weak references are kept, so an antenna is freed once neither a PHY nor an AirFrame in flight refers to it.
+ */
+std::map<std::string, std::weak_ptr<Antenna>>& sharedAntennas()
+{
+    static std::map<std::string, std::weak_ptr<Antenna>> antennas;
+    return antennas;
+}
+
+} // namespace
+
+std::shared_ptr<Antenna> BasePhyLayer::getSharedAntenna(const std::string& key, std::function<std::shared_ptr<Antenna>()> factory)
+{
+    std::weak_ptr<Antenna>& entry = sharedAntennas()[key];
+    std::shared_ptr<Antenna> shared = entry.lock();
+    if (!shared) {
+        shared = factory();
+        entry = shared;
+    }
+    return shared;
+}
+
 std::shared_ptr<Antenna> BasePhyLayer::getAntennaFromName(std::string name, ParameterMap& params)
 {
     if (name == "SampledAntenna1D") {
         return initializeSampledAntenna1D(params);
     }
 
-    return std::make_shared<Antenna>();
+    return getSharedAntenna("Antenna", [] { return std::make_shared<Antenna>(); });
 }
 
 std::shared_ptr<Antenna> BasePhyLayer::initializeSampledAntenna1D(ParameterMap& params)
@@ -319,6 +338,16 @@ std::shared_ptr<Antenna> BasePhyLayer::initializeSampledAntenna1D(ParameterMap&
         std::copy(std::istream_iterator<double>(rotationStream), std::istream_iterator<double>(), std::back_inserter(rotationParams));
     }
 
+    // antennas without randomness are fully determined by their samples, so they can be shared by all PHYs
+    if (offsetType.empty() && rotationType.empty()) {
+        std::stringstream key;
+        key << "SampledAntenna1D" << std::setprecision(17);
+        for (auto value : values) {
+            key << " " << value;
+        }
+        return getSharedAntenna(key.str(), [&] { return std::make_shared<SampledAntenna1D>(values, offsetType, offsetParams, rotationType, rotationParams, nullptr); });
+    }
+
     return std::make_shared<SampledAntenna1D>(values, offsetType, offsetParams, rotationType, rotationParams, this->getRNG(0));
 }
 
@@ -339,6 +368,8 @@ void BasePhyLayer::initializeAnalogueModels(cXMLElement* xmlConfig)
 
     // iterate over all AnalogueModel-entries, get a new AnalogueModel instance and add
     // it to analogueModels
+    PhyConfigurationCache& configurationCache = world->getPhyConfigurationCache();
+
     for (auto&& analogueModelData : analogueModelList) {
         const char* name = analogueModelData->getAttribute("type");
         const char* thresholdingFlag = analogueModelData->getAttribute("thresholding");
@@ -347,13 +378,24 @@ void BasePhyLayer::initializeAnalogueModels(cXMLElement* xmlConfig)
             throw cRuntimeError("Could not read name of analogue model.");
         }
 
-        ParameterMap params;
-        getParametersFromXML(analogueModelData, params);
-
-        auto newAnalogueModel = getAnalogueModelFromName(name, params);
+        // reuse the instance of another PHY, if the model has been configured and found to be stateless before
+        std::shared_ptr<AnalogueModel> newAnalogueModel = configurationCache.getSharedAnalogueModel(analogueModelData);
 
         if (!newAnalogueModel) {
-            throw cRuntimeError("Could not find an analogue model with the name \"%s\".", name);
+            ParameterMap params;
+            getParametersFromXML(analogueModelData, params);
+
+            newAnalogueModel = getAnalogueModelFromName(name, params);
+
+            if (!newAnalogueModel) {
+                throw cRuntimeError("Could not find an analogue model with the name \"%s\".", name);
+            }
+
+            if (newAnalogueModel->isStateless()) {
+                // hand the model over to a module that outlives this PHY
+                newAnalogueModel->setOwner(world);
+                configurationCache.setSharedAnalogueModel(analogueModelData, newAnalogueModel);
+            }
         }
 
         // attach the new AnalogueModel to the AnalogueModelList
@@ -369,6 +411,11 @@ void BasePhyLayer::initializeAnalogueModels(cXMLElement* xmlConfig)
 
         EV_TRACE << "AnalogueModel \"" << name << "\" loaded." << endl;
     }
+
+    numThreadSafeAnalogueModels = 0;
+    while (numThreadSafeAnalogueModels < analogueModels.size() && analogueModels[numThreadSafeAnalogueModels]->isThreadSafe()) {
+        numThreadSafeAnalogueModels++;
+    }
 }
 
 // --Message handling--------------------------------------
@@ -647,35 +694,164 @@ void BasePhyLayer::filterSignal(AirFrame* frame)
     ASSERT(dynamic_cast<ChannelAccess* const>(frame->getSenderModule()));
     Signal& signal = frame->getSignal();
 
-    // Extract position and orientation of sender and receiver (this module) first
-    const AntennaPosition receiverPosition = antennaPosition;
-    const Coord receiverOrientation = antennaHeading.toCoord();
-    // get POA from frame with the sender's position, orientation and antenna
-    POA& senderPOA = frame->getPoa();
-    const AntennaPosition senderPosition = senderPOA.pos;
-    const Coord senderOrientation = senderPOA.orientation;
+    size_t firstAnalogueModel = 0;
+    if (signal.getAnalogueModelList() != &analogueModels) {
+        setSignalPoas(signal, frame->getPoa());
+        if (cacheLinkBudgets) {
+            applyLinkBudget(signal);
+            firstAnalogueModel = numCachedAnalogueModels;
+        }
+        else {
+            applyAntennaGains(signal);
+        }
+    }
+    else {
+        // antenna gains and the first analogue models have been applied when the frame was sent
+        firstAnalogueModel = signal.getNumAnalogueModelsApplied();
+    }
+
+    // go on with AnalogueModels
+    // attach analogue models suitable for thresholding to signal (for later evaluation)
+    signal.setAnalogueModelList(&analogueModelsThresholding);
+
+    // apply all analouge models that are *not* suitable for thresholding now
+    for (size_t i = firstAnalogueModel; i < analogueModels.size(); i++) {
+        analogueModels[i]->filterSignal(&signal);
+    }
+}
+
+void BasePhyLayer::setSignalPoas(Signal& signal, const POA& senderPoa)
+{
+    signal.setSenderPoa(senderPoa);
+    signal.setReceiverPoa({antennaPosition, antennaHeading.toCoord(), antenna});
+}
 
-    // add position information to signal
-    signal.setSenderPoa(senderPOA);
-    signal.setReceiverPoa({receiverPosition, receiverOrientation, antenna});
+void BasePhyLayer::applyAntennaGains(Signal& signal) const
+{
+    const POA senderPoa = signal.getSenderPoa();
+    const POA receiverPoa = signal.getReceiverPoa();
+    const Coord senderPos = senderPoa.pos.getPositionAt();
+    const Coord receiverPos = receiverPoa.pos.getPositionAt();
 
     // compute gains at sender and receiver antenna
-    double receiverGain = antenna->getGain(receiverPosition.getPositionAt(), receiverOrientation, senderPosition.getPositionAt());
-    double senderGain = senderPOA.antenna->getGain(senderPosition.getPositionAt(), senderOrientation, receiverPosition.getPositionAt());
+    double receiverGain = receiverPoa.antenna->getGain(receiverPos, receiverPoa.orientation, senderPos);
+    double senderGain = senderPoa.antenna->getGain(senderPos, senderPoa.orientation, receiverPos);
 
     // add the resulting total gain to the attenuations list
     EV_TRACE << "Sender's antenna gain: " << senderGain << endl;
     EV_TRACE << "Own (receiver's) antenna gain: " << receiverGain << endl;
     signal *= receiverGain * senderGain;
+}
 
-    // go on with AnalogueModels
-    // attach analogue models suitable for thresholding to signal (for later evaluation)
-    signal.setAnalogueModelList(&analogueModelsThresholding);
+void BasePhyLayer::applyLinkBudget(Signal& signal)
+{
+    const POA senderPoa = signal.getSenderPoa();
+    const POA receiverPoa = signal.getReceiverPoa();
 
-    // apply all analouge models that are *not* suitable for thresholding now
-    for (auto& analogueModel : analogueModels) {
-        analogueModel->filterSignal(&signal);
+    auto isSamePoa = [](const POA& a, const POA& b) {
+        return a.pos.isSameState(b.pos) && a.orientation == b.orientation && a.antenna == b.antenna;
+    };
+
+    // models report changes of their environment (e.g., buildings added at runtime) through their generation
+    uint64_t generation = 0;
+    for (size_t i = 0; i < numCachedAnalogueModels; i++) {
+        generation += analogueModels[i]->getGeneration();
     }
+
+    auto entry = linkBudgets.find(senderPoa.pos.getId());
+    if (entry == linkBudgets.end() || entry->second.generation != generation || !(entry->second.spectrum == signal.getSpectrum()) || !isSamePoa(entry->second.senderPoa, senderPoa) || !isSamePoa(entry->second.receiverPoa, receiverPoa)) {
+        linkBudgetMisses++;
+
+        // drop entries of senders not heard from since the last purge, once the cache has doubled in size
+        if (linkBudgets.size() >= 2 * numLinkBudgetsAfterPurge + 16) {
+            for (auto i = linkBudgets.begin(); i != linkBudgets.end();) {
+                if (i->second.used) {
+                    i->second.used = false;
+                    ++i;
+                }
+                else {
+                    i = linkBudgets.erase(i);
+                }
+            }
+            numLinkBudgetsAfterPurge = linkBudgets.size();
+        }
+
+        // evaluate gains and models on a signal of unit power
+        Signal unit(signal);
+        unit = 1;
+        applyAntennaGains(unit);
+        for (size_t i = 0; i < numCachedAnalogueModels; i++) {
+            analogueModels[i]->filterSignal(&unit);
+        }
+
+        LinkBudget& linkBudget = linkBudgets[senderPoa.pos.getId()];
+        linkBudget.senderPoa = senderPoa;
+        linkBudget.receiverPoa = receiverPoa;
+        linkBudget.spectrum = signal.getSpectrum();
+        linkBudget.generation = generation;
+        linkBudget.factors.assign(unit.getValues(), unit.getValues() + unit.getNumValues());
+        entry = linkBudgets.find(senderPoa.pos.getId());
+    }
+    else {
+        linkBudgetHits++;
+    }
+
+    LinkBudget& linkBudget = entry->second;
+    linkBudget.used = true;
+    double* values = signal.getValues();
+    for (size_t i = 0; i < signal.getNumValues(); i++) {
+        values[i] *= linkBudget.factors[i];
+    }
+}
+
+void BasePhyLayer::prepareChannelCopies(std::vector<ChannelCopy>& copies)
+{
+    if (!parallelAnalogueModels) return;
+
+    struct Reception {
+        BasePhyLayer* receiver;
+        AirFrame* frame;
+    };
+    std::vector<Reception> receptions;
+    receptions.reserve(copies.size());
+
+    // attach positions and random streams, and let the models fill their caches, on the simulation thread
+    for (auto&& copy : copies) {
+        auto receiver = dynamic_cast<BasePhyLayer*>(copy.nic->chAccess);
+        if (receiver == nullptr || !receiver->parallelAnalogueModels) continue;
+
+        auto frame = static_cast<AirFrame*>(copy.msg);
+        Signal& signal = frame->getSignal();
+        if (receiver->usePropagationDelay) {
+            signal.setPropagationDelay(copy.propagationDelay);
+        }
+        receiver->setSignalPoas(signal, frame->getPoa());
+        signal.setRandomStreamKey(CounterRng::combine(receiver->randomStreamSeed, frame->getId()));
+        for (size_t i = 0; i < receiver->numThreadSafeAnalogueModels; i++) {
+            receiver->analogueModels[i]->prepareConcurrentFiltering(signal);
+        }
+
+        receptions.push_back({receiver, frame});
+    }
+
+    // each receiver appears at most once, so its link budgets are only accessed by one thread
+    world->getThreadPool().parallelFor(receptions.size(), [&receptions](size_t i) {
+        BasePhyLayer* receiver = receptions[i].receiver;
+        Signal& signal = receptions[i].frame->getSignal();
+        size_t firstAnalogueModel = 0;
+        if (receiver->cacheLinkBudgets) {
+            receiver->applyLinkBudget(signal);
+            firstAnalogueModel = receiver->numCachedAnalogueModels;
+        }
+        else {
+            receiver->applyAntennaGains(signal);
+        }
+        for (size_t m = firstAnalogueModel; m < receiver->numThreadSafeAnalogueModels; m++) {
+            receiver->analogueModels[m]->filterSignal(&signal);
+        }
+        // lets filterSignal() go on after the models applied here
+        signal.setAnalogueModelList(&receiver->analogueModels, receiver->numThreadSafeAnalogueModels);
+    });
 }
 
 // --Destruction--------------------------------
@@ -24,10 +24,12 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <vector>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 #include "veins/veins.h"
 
@@ -36,6 +38,8 @@
 #include "veins/base/phyLayer/MacToPhyInterface.h"
 #include "veins/base/phyLayer/Antenna.h"
 #include "veins/base/phyLayer/ChannelInfo.h"
+#include "veins/base/toolbox/Spectrum.h"
+#include "veins/base/utils/POA.h"
 
 namespace veins {
 
@@ -124,6 +128,7 @@ protected:
      * Shared pointer to the Antenna used for this node.
      *
      * Using a shared pointer ensures proper handling of a signal is possible, even after the sender has been destroyed.
+     * Antennas are immutable, so PHYs with identical (deterministic) antenna configurations share the same instance.
      */
     std::shared_ptr<Antenna> antenna;
 
@@ -131,6 +136,8 @@ protected:
 
     /**
      * The analogue models to use which might attenuate or amplify a signal.
+     *
+     * Stateless models are shared with all other PHYs using the same configuration.
      */
     AnalogueModelList analogueModels;
 
@@ -142,6 +149,50 @@ protected:
      */
     AnalogueModelList analogueModelsThresholding;
 
+    /**
+     * Whether antenna gains and thread-safe analogue models are evaluated for all receivers when a frame is sent.
+     *
+     * @see prepareChannelCopies
+     */
+    bool parallelAnalogueModels = false;
+
+    /** Number of leading entries of analogueModels that are thread-safe, i.e., can be evaluated when a frame is sent. */
+    size_t numThreadSafeAnalogueModels = 0;
+
+    /** Key of the random streams of frames received by this PHY (if parallelAnalogueModels is set), combined with the AirFrame id. */
+    uint64_t randomStreamSeed = 0;
+
+    /**
+     * Attenuation of one link due to antenna gains and the first numCachedAnalogueModels analogue models.
+     */
+    struct LinkBudget {
+        POA senderPoa; ///< sender POA the factors have been computed for
+        POA receiverPoa; ///< receiver (i.e., own) POA the factors have been computed for
+        Spectrum spectrum; ///< Spectrum the factors have been computed for
+        uint64_t generation = 0; ///< sum of the cached analogue models' generations the factors have been computed at
+        std::vector<double> factors; ///< one linear factor per frequency of spectrum
+        bool used = true; ///< whether the entry has been used since the last purge
+    };
+
+    /**
+     * Whether antenna gains and the leading deterministic analogue models are cached per link.
+     *
+     * @see applyLinkBudget
+     */
+    bool cacheLinkBudgets = false;
+
+    /** Number of leading entries of analogueModels whose attenuation is cached per link (if cacheLinkBudgets is set). */
+    size_t numCachedAnalogueModels = 0;
+
+    /** Cached link budgets, by antenna id of the sender. */
+    std::unordered_map<int, LinkBudget> linkBudgets;
+
+    /** Number of linkBudgets after the last purge of unused entries. */
+    size_t numLinkBudgetsAfterPurge = 0;
+
+    long linkBudgetHits = 0; ///< number of signals attenuated by a cached link budget
+    long linkBudgetMisses = 0; ///< number of signals that needed a link budget to be computed
+
     int upperLayerIn; ///< The id of the in-data gate from the Mac layer.
     int upperLayerOut; ///< The id of the out-data gate to the Mac layer.
     int upperControlOut; ///< The id of the out-control gate to the Mac layer.
@@ -155,6 +206,8 @@ protected:
 private:
     /**
      * Read the parameters of a XML element and stores them in the passed ParameterMap reference.
+     *
+     * Each XML element is only parsed once per simulation, see PhyConfigurationCache.
      */
     void getParametersFromXML(cXMLElement* xmlData, ParameterMap& outputMap);
 
@@ -231,10 +284,19 @@ protected:
      */
     virtual std::shared_ptr<Antenna> getAntennaFromName(std::string name, ParameterMap& params);
 
+    /**
+     * Returns the process-wide Antenna instance registered for the given configuration key.
+     *
+     * If no PHY currently uses an antenna with this key, a new one is created by calling the passed factory.
+     * Only antennas whose gains are fully determined by the key (i.e., that do not draw random numbers) may be shared this way.
+     */
+    static std::shared_ptr<Antenna> getSharedAntenna(const std::string& key, std::function<std::shared_ptr<Antenna>()> factory);
+
     /**
      * Creates and returns an instance of the SampledAntenna1D class as a shared pointer.
      *
      * The given parameters (i.e. samples and optional randomness parameters) are evaluated and passed to the antenna's constructor.
+     * If no randomness is configured, an existing antenna with the same samples is reused.
      */
     virtual std::shared_ptr<Antenna> initializeSampledAntenna1D(ParameterMap& params);
 
@@ -339,6 +401,37 @@ protected:
      */
     virtual void filterSignal(AirFrame* frame);
 
+    /**
+     * Set the sender's and this PHY's POA on the passed Signal.
+     */
+    void setSignalPoas(Signal& signal, const POA& senderPoa);
+
+    /**
+     * Multiply the gains of sender and receiver (this PHY) antenna into the passed Signal.
+     *
+     * The Signal's POAs must already be set.
+     */
+    void applyAntennaGains(Signal& signal) const;
+
+    /**
+     * Multiply the gains of sender and receiver (this PHY) antenna and the first numCachedAnalogueModels analogue models into the passed Signal.
+     *
+     * Reuses the factors computed for an earlier Signal of the same sender if both POAs and the spectrum are the same (see AntennaPosition::isSameState).
+     * Otherwise, computes and stores them.
+     * The Signal's POAs must already be set.
+     */
+    void applyLinkBudget(Signal& signal);
+
+    /**
+     * Evaluate antenna gains and the thread-safe leading analogue models of all receiving PHYs which enabled parallelAnalogueModels.
+     *
+     * The copies are evaluated concurrently on the threads of the world utility module.
+     * Each Signal gets a random stream, keyed by receiver and AirFrame, so results do not depend on the number of threads.
+     * Receiver positions are those at the time the frame is sent.
+     * filterSignal only applies the remaining analogue models when the copy is received.
+     */
+    void prepareChannelCopies(std::vector<ChannelCopy>& copies) override;
+
     /**
      * Called when the switching process of the Radio is finished.
      *
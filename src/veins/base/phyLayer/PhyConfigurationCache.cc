@@ -0,0 +1,87 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/base/phyLayer/PhyConfigurationCache.h"
+
+using namespace veins;
+
+const PhyConfigurationCache::ParameterMap& PhyConfigurationCache::getParameters(cXMLElement* xmlData)
+{
+    auto it = parameters.find(xmlData);
+    if (it == parameters.end()) {
+        it = parameters.emplace(xmlData, ParameterMap()).first;
+        parseParameters(xmlData, it->second);
+    }
+    return it->second;
+}
+
+std::shared_ptr<AnalogueModel> PhyConfigurationCache::getSharedAnalogueModel(cXMLElement* xmlData) const
+{
+    auto it = analogueModels.find(xmlData);
+    if (it == analogueModels.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void PhyConfigurationCache::setSharedAnalogueModel(cXMLElement* xmlData, std::shared_ptr<AnalogueModel> analogueModel)
+{
+    analogueModels[xmlData] = std::move(analogueModel);
+}
+
+void PhyConfigurationCache::parseParameters(cXMLElement* xmlData, ParameterMap& outputMap)
+{
+    cXMLElementList parameters = xmlData->getElementsByTagName("Parameter");
+
+    for (cXMLElementList::const_iterator it = parameters.begin(); it != parameters.end(); it++) {
+
+        const char* name = (*it)->getAttribute("name");
+        const char* type = (*it)->getAttribute("type");
+        const char* value = (*it)->getAttribute("value");
+        if (name == nullptr || type == nullptr || value == nullptr) throw cRuntimeError("Invalid parameter, could not find name, type or value");
+
+        std::string sType = type; // needed for easier comparision
+        std::string sValue = value; // needed for easier comparision
+
+        cMsgPar param(name);
+
+        // parse type of parameter and set value
+        if (sType == "bool") {
+            param.setBoolValue(sValue == "true" || sValue == "1");
+        }
+        else if (sType == "double") {
+            param.setDoubleValue(strtod(value, nullptr));
+        }
+        else if (sType == "string") {
+            param.setStringValue(value);
+        }
+        else if (sType == "long") {
+            param.setLongValue(strtol(value, nullptr, 0));
+        }
+        else {
+            throw cRuntimeError("Unknown parameter type: '%s'", sType.c_str());
+        }
+
+        // add parameter to output map
+        outputMap[name] = param;
+    }
+}
@@ -0,0 +1,77 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "veins/veins.h"
+
+#include "veins/base/phyLayer/AnalogueModel.h"
+
+namespace veins {
+
+/**
+ * @brief Keeps the PHY configuration read from XML, so it is parsed only once per simulation.
+ *
+ * Entries are keyed by the identity of the XML element they were read from.
+ * As XML documents are cached by the simulation environment, all PHYs using the same configuration file see the same elements.
+ *
+ * Besides the parameters of each element, the cache holds the AnalogueModel instances that are shared among all PHYs
+ * (see AnalogueModel::isStateless()).
+ *
+ * One instance is kept by the BaseWorldUtility, so its lifetime (and that of the objects referenced by shared models) is that of the network.
+ *
+ * @ingroup phyLayer
+ */
+class VEINS_API PhyConfigurationCache {
+public:
+    using ParameterMap = std::map<std::string, cMsgPar>;
+
+    /**
+     * Return the parameters of the given XML element, parsing them on first access.
+     */
+    const ParameterMap& getParameters(cXMLElement* xmlData);
+
+    /**
+     * Return the AnalogueModel shared for the given XML element, or nullptr if there is none (yet).
+     */
+    std::shared_ptr<AnalogueModel> getSharedAnalogueModel(cXMLElement* xmlData) const;
+
+    /**
+     * Register the AnalogueModel to share for the given XML element.
+     */
+    void setSharedAnalogueModel(cXMLElement* xmlData, std::shared_ptr<AnalogueModel> analogueModel);
+
+    /**
+     * Read the parameters of a XML element and store them in the passed ParameterMap reference.
+     */
+    static void parseParameters(cXMLElement* xmlData, ParameterMap& outputMap);
+
+private:
+    std::map<const cXMLElement*, ParameterMap> parameters;
+    std::map<const cXMLElement*, std::shared_ptr<AnalogueModel>> analogueModels;
+};
+
+} // namespace veins
@@ -42,6 +42,8 @@ Signal::Signal(const Signal& other)
     , numAnalogueModelsApplied(other.numAnalogueModelsApplied)
     , senderPoa(other.senderPoa)
     , receiverPoa(other.receiverPoa)
+    , randomStreamUsed(other.randomStreamUsed)
+    , randomStreamKey(other.randomStreamKey)
 {
 }
 
@@ -219,9 +221,11 @@ AnalogueModelList* Signal::getAnalogueModelList() const
     return analogueModelList;
 }
 
-void Signal::setAnalogueModelList(AnalogueModelList* list)
+void Signal::setAnalogueModelList(AnalogueModelList* list, uint16_t numApplied)
 {
+    ASSERT(list == nullptr || numApplied <= list->size());
     analogueModelList = list;
+    numAnalogueModelsApplied = numApplied;
 }
 
 void Signal::applyAnalogueModel(uint16_t index)
@@ -264,6 +268,23 @@ void Signal::setReceiverPoa(const POA& poa)
     receiverPoa = poa;
 }
 
+bool Signal::hasRandomStream() const
+{
+    return randomStreamUsed;
+}
+
+CounterRng Signal::getRandomStream() const
+{
+    ASSERT(randomStreamUsed);
+    return CounterRng(randomStreamKey);
+}
+
+void Signal::setRandomStreamKey(uint64_t key)
+{
+    randomStreamKey = key;
+    randomStreamUsed = true;
+}
+
 simtime_t_cref Signal::getSendingStart() const
 {
     return sendingStart;
@@ -336,6 +357,9 @@ Signal& Signal::operator=(const Signal& other)
     senderPoa = other.getSenderPoa();
     receiverPoa = other.getReceiverPoa();
 
+    randomStreamUsed = other.randomStreamUsed;
+    randomStreamKey = other.randomStreamKey;
+
     timingUsed = other.hasTiming();
     sendingStart = other.getSendingStart();
     duration = other.getDuration();
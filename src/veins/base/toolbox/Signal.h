@@ -26,6 +26,7 @@
 
 #include "veins/base/utils/POA.h"
 #include "veins/base/utils/Coord.h"
+#include "veins/base/utils/CounterRng.h"
 #include "veins/base/toolbox/Spectrum.h"
 #include "veins/base/phyLayer/AnalogueModel.h"
 
@@ -264,8 +265,9 @@ public:
      * Set the AnalogueModels associated with this Signal.
      *
      * @param list the new list of AnalogueModels
+     * @param numApplied the number of leading models in the list that have already been applied
      */
-    void setAnalogueModelList(AnalogueModelList* list);
+    void setAnalogueModelList(AnalogueModelList* list, uint16_t numApplied = 0);
 
     /**
      * Apply a specific AnalogueModel.
@@ -317,6 +319,33 @@ public:
     void setReceiverPoa(const POA& poa);
     ///@}
 
+    /**
+     * @name Random numbers
+     */
+    ///@{
+    /**
+     * Predicate which indicates presence of a random stream key.
+     *
+     * AnalogueModels draw random numbers from getRandomStream() if present, and from the context module's RNG otherwise.
+     */
+    bool hasRandomStream() const;
+
+    /**
+     * Get a new counter-based random number stream for this signal.
+     *
+     * Every call returns a stream that starts over, i.e., yields the same sequence of numbers for the same signal.
+     * Only valid if hasRandomStream() returns true.
+     */
+    CounterRng getRandomStream() const;
+
+    /**
+     * Set the key of this signal's random number stream.
+     *
+     * @param key the new key, e.g., derived from receiver and AirFrame id
+     */
+    void setRandomStreamKey(uint64_t key);
+    ///@}
+
     /**
      * Timing
      */
@@ -515,6 +544,9 @@ private:
 
     POA senderPoa;
     POA receiverPoa;
+
+    bool randomStreamUsed = false;
+    uint64_t randomStreamKey = 0;
 };
 
 /**
@@ -26,6 +26,8 @@
 
 namespace veins {
 
+namespace {
+
 Spectrum::Frequencies normalizeFrequencies(Spectrum::Frequencies freqs)
 {
     // sort and deduplicate frequencies first
@@ -34,39 +36,61 @@ Spectrum::Frequencies normalizeFrequencies(Spectrum::Frequencies freqs)
     return freqs;
 }
 
+std::shared_ptr<const Spectrum::Frequencies> internFrequencies(Spectrum::Frequencies freqs)
+{
+    // spectra are few and small, so interned frequencies are kept for the lifetime of the process
+    static std::map<Spectrum::Frequencies, std::shared_ptr<const Spectrum::Frequencies>> internedFrequencies;
+
+    auto normalized = normalizeFrequencies(std::move(freqs));
+    auto it = internedFrequencies.find(normalized);
+    if (it == internedFrequencies.end()) {
+        auto interned = std::make_shared<const Spectrum::Frequencies>(normalized);
+        it = internedFrequencies.emplace(std::move(normalized), std::move(interned)).first;
+    }
+    return it->second;
+}
+
+} // namespace
+
+Spectrum::Spectrum()
+    : frequencies(internFrequencies({}))
+{
+}
+
 Spectrum::Spectrum(Spectrum::Frequencies freqs)
-    : frequencies(normalizeFrequencies(freqs))
+    : frequencies(internFrequencies(std::move(freqs)))
 {
 }
 
 const double& Spectrum::operator[](size_t index) const
 {
-    return frequencies.at(index);
+    return frequencies->at(index);
 }
 
 size_t Spectrum::indexOf(double freq) const
 {
     // Binary search
-    auto it = std::lower_bound(frequencies.begin(), frequencies.end(), freq);
-    bool found = it != frequencies.end() && (*it) == freq;
+    auto it = std::lower_bound(frequencies->begin(), frequencies->end(), freq);
+    bool found = it != frequencies->end() && (*it) == freq;
 
     ASSERT(found == true);
 
-    return std::distance(frequencies.begin(), it);
+    return std::distance(frequencies->begin(), it);
 }
 
 double Spectrum::freqAt(size_t freqIndex) const
 {
-    return frequencies.at(freqIndex);
+    return frequencies->at(freqIndex);
 }
 
 size_t Spectrum::getNumFreqs() const
 {
-    return frequencies.size();
+    return frequencies->size();
 }
 
 bool operator==(const Spectrum& lhs, const Spectrum& rhs)
 {
+    // frequencies are interned, so equal spectra share the same frequencies object
     return lhs.frequencies == rhs.frequencies;
 }
 
@@ -74,7 +98,7 @@ std::ostream& operator<<(std::ostream& os, const Spectrum& s)
 {
     os << "Spectrum(";
     std::ostringstream ss;
-    for (auto&& frequency : s.frequencies) {
+    for (auto&& frequency : *s.frequencies) {
         if (ss.tellp() != 0) {
             ss << ", ";
         }
@@ -35,12 +35,19 @@
 
 namespace veins {
 
+/**
+ * Set of (sorted, unique) frequencies a Signal is defined on.
+ *
+ * Frequency sets are interned: all Spectrum objects with the same frequencies share one immutable copy of them.
+ * Copying a Spectrum is therefore cheap and comparing two Spectrum objects only compares pointers.
+ * This also allows analogue models to cache values derived from a Spectrum (see getId()).
+ */
 class VEINS_API Spectrum {
 public:
     using Frequency = double;
     using Frequencies = std::vector<Frequency>;
 
-    Spectrum() = default;
+    Spectrum();
     Spectrum(Frequencies freqs);
 
     const double& operator[](size_t index) const;
@@ -51,12 +58,22 @@ public:
 
     double freqAt(size_t freqIndex) const;
 
+    /**
+     * Return an identifier of the (interned) frequencies of this Spectrum.
+     *
+     * Two Spectrum objects compare equal if and only if their identifiers are equal.
+     */
+    const void* getId() const
+    {
+        return frequencies.get();
+    }
+
     friend bool VEINS_API operator==(const Spectrum& lhs, const Spectrum& rhs);
 
     friend std::ostream& VEINS_API operator<<(std::ostream& os, const Spectrum& s);
 
 private:
-    Frequencies frequencies;
+    std::shared_ptr<const Frequencies> frequencies;
 };
 
 } // namespace veins
@@ -66,6 +66,14 @@ public:
         return p + v * dt.dbl();
     }
 
+    /**
+     * Get the unique identifier of the antenna (see ChannelAccess::getId()).
+     */
+    int getId() const
+    {
+        return id;
+    }
+
     bool isSameAntenna(const AntennaPosition& o) const
     {
         ASSERT(!undef);
@@ -73,6 +81,18 @@ public:
         return (id == o.id);
     }
 
+    /**
+     * Return whether o describes the same antenna moving the same way, i.e., whether it results in the same positions.
+     *
+     * Antennas standing still are in the same state even if their positions have been stored at different times.
+     */
+    bool isSameState(const AntennaPosition& o) const
+    {
+        if (undef || o.undef) return false;
+        if (id != o.id || p != o.p || v != o.v) return false;
+        return (v == Coord::ZERO) || (t == o.t);
+    }
+
 protected:
     int id; /**< unique identifier of antenna returned by ChannelAccess::getId() */
     Coord p; /**< position for linear extrapolation */
@@ -0,0 +1,127 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief A counter-based random number stream.
+ *
+ * The n-th number of a stream only depends on the stream's key and on n, so streams can be created on the fly (e.g., one per link and frame) and used from any thread.
+ * Results therefore do not depend on the order in which streams are used.
+ *
+ * Numbers are obtained by passing key and counter through the SplitMix64 finalizer, which is not of cryptographic quality, but passes common statistical test suites.
+ *
+ * @ingroup baseUtils
+ */
+class VEINS_API CounterRng {
+public:
+    explicit CounterRng(uint64_t key)
+        : key(key)
+    {
+    }
+
+    /**
+     * Derives a new key from two values (e.g., a per-node seed and a frame id).
+     */
+    static uint64_t combine(uint64_t a, uint64_t b)
+    {
+        return mix(a ^ mix(b + 0x9e3779b97f4a7c15ULL));
+    }
+
+    /**
+     * Returns the next 64 random bits of this stream.
+     */
+    uint64_t next()
+    {
+        return mix(key + (++counter) * 0x9e3779b97f4a7c15ULL);
+    }
+
+    /**
+     * Returns a number uniformly distributed in (0, 1).
+     */
+    double uniform()
+    {
+        return ((next() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * Returns a normally distributed number with mean 0 and standard deviation 1 (Box-Muller).
+     */
+    double normal()
+    {
+        double u1 = uniform();
+        double u2 = uniform();
+        return std::sqrt(-2 * std::log(u1)) * std::cos(2 * M_PI * u2);
+    }
+
+    /**
+     * Returns a gamma distributed number with shape alpha and scale theta (i.e., mean alpha * theta), like omnetpp::gamma_d.
+     *
+     * Uses the method of Marsaglia and Tsang.
+     */
+    double gamma(double alpha, double theta)
+    {
+        ASSERT(alpha > 0 && theta > 0);
+
+        if (alpha < 1) {
+            // boost shape by one, then scale back down
+            double u = uniform();
+            return gamma(alpha + 1, theta) * std::pow(u, 1 / alpha);
+        }
+
+        const double d = alpha - 1.0 / 3;
+        const double c = 1 / std::sqrt(9 * d);
+        while (true) {
+            double x;
+            double v;
+            do {
+                x = normal();
+                v = 1 + c * x;
+            } while (v <= 0);
+            v = v * v * v;
+            double u = uniform();
+            if (u < 1 - 0.0331 * x * x * x * x) return d * v * theta;
+            if (std::log(u) < 0.5 * x * x + d * (1 - v + std::log(v))) return d * v * theta;
+        }
+    }
+
+protected:
+    static uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t key;
+    uint64_t counter = 0;
+};
+
+} // namespace veins
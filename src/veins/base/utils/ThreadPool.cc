@@ -0,0 +1,193 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/utils/ThreadPool.h"
+
+#include <algorithm>
+
+using namespace veins;
+
+namespace {
+
+thread_local bool inParallelSection = false;
+
+/**
+ * Marks the current thread as processing work items while in scope.
+ */
+class ParallelSectionMarker {
+public:
+    ParallelSectionMarker()
+    {
+        inParallelSection = true;
+    }
+    ~ParallelSectionMarker()
+    {
+        inParallelSection = false;
+    }
+};
+
+thread_local bool isWorkerThread = false;
+
+cLog::NoncomponentLogPredicate savedNoncomponentLogPredicate = nullptr;
+cLog::ComponentLogPredicate savedComponentLogPredicate = nullptr;
+
+/**
+ * Drops log output from worker threads, delegates to the previously installed predicate otherwise.
+ */
+bool noncomponentLogPredicate(const void* object, LogLevel logLevel, const char* category)
+{
+    return !isWorkerThread && savedNoncomponentLogPredicate(object, logLevel, category);
+}
+
+/**
+ * Drops log output from worker threads, delegates to the previously installed predicate otherwise.
+ */
+bool componentLogPredicate(const cComponent* object, LogLevel logLevel, const char* category)
+{
+    return !isWorkerThread && savedComponentLogPredicate(object, logLevel, category);
+}
+
+/**
+ * Wraps the global log predicates (once per process) so that EV output from worker threads is dropped.
+ */
+void installLogPredicates()
+{
+    if (cLog::noncomponentLogPredicate != &noncomponentLogPredicate) {
+        savedNoncomponentLogPredicate = cLog::noncomponentLogPredicate;
+        cLog::noncomponentLogPredicate = &noncomponentLogPredicate;
+    }
+    if (cLog::componentLogPredicate != &componentLogPredicate) {
+        savedComponentLogPredicate = cLog::componentLogPredicate;
+        cLog::componentLogPredicate = &componentLogPredicate;
+    }
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (numThreads > 1) {
+        installLogPredicates();
+    }
+    for (size_t i = 1; i < numThreads; i++) {
+        workers.emplace_back(&ThreadPool::runWorker, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+bool ThreadPool::isInParallelSection()
+{
+    return inParallelSection;
+}
+
+void ThreadPool::parallelFor(size_t n, const std::function<void(size_t)>& work)
+{
+    if (n == 0) return;
+
+    if (inParallelSection) {
+        for (size_t i = 0; i < n; i++) {
+            work(i);
+        }
+        return;
+    }
+
+    bool wakeWorkers;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->work = &work;
+        numItems = n;
+        nextItem = 0;
+        firstException = nullptr;
+        // only let as many workers join as there are items left for them
+        openSlots = std::min(workers.size(), n - 1);
+        busyWorkers = openSlots;
+        wakeWorkers = openSlots > 0;
+        generation++;
+    }
+    if (wakeWorkers) {
+        jobAvailable.notify_all();
+    }
+
+    processItems();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this] { return busyWorkers == 0; });
+    this->work = nullptr;
+
+    if (firstException) {
+        std::exception_ptr exception = firstException;
+        firstException = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void ThreadPool::processItems()
+{
+    ParallelSectionMarker marker;
+    for (size_t i = nextItem++; i < numItems; i = nextItem++) {
+        try {
+            (*work)(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!firstException) firstException = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::runWorker()
+{
+    isWorkerThread = true;
+    size_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobAvailable.wait(lock, [this, &seenGeneration] { return stopping || (generation != seenGeneration && openSlots > 0); });
+            if (stopping) return;
+            seenGeneration = generation;
+            openSlots--;
+        }
+
+        processItems();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busyWorkers--;
+        }
+        jobDone.notify_one();
+    }
+}
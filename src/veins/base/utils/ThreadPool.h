@@ -0,0 +1,107 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief A fixed set of worker threads to spread independent work items of one simulation event across cores.
+ *
+ * Work is submitted with parallelFor(), which returns once all items have been processed.
+ * The calling thread takes part in processing, so a pool of one thread runs all items inline.
+ *
+ * Work items must neither send or schedule messages nor switch the simulation's context (e.g., via Enter_Method).
+ * Logging via EV is not thread-safe, so output from the worker threads is dropped; the calling thread logs as usual.
+ * Code that needs to behave differently on worker threads can check isInParallelSection().
+ *
+ * @ingroup baseUtils
+ */
+class VEINS_API ThreadPool {
+public:
+    /**
+     * @param numThreads total number of threads to use (including the calling thread), or 0 to use one per hardware thread
+     */
+    explicit ThreadPool(size_t numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Returns the total number of threads processing work items (including the calling thread).
+     */
+    size_t getNumThreads() const
+    {
+        return workers.size() + 1;
+    }
+
+    /**
+     * Calls work(i) for every i in [0, n) and returns once all calls have finished.
+     *
+     * Calls may happen concurrently and in any order.
+     * If any call throws, the first exception caught is rethrown once all calls have finished.
+     * Nested calls (from within a work item) run inline.
+     */
+    void parallelFor(size_t n, const std::function<void(size_t)>& work);
+
+    /**
+     * Returns whether the current thread is processing a work item of parallelFor().
+     */
+    static bool isInParallelSection();
+
+protected:
+    /** @brief Main loop of each worker thread. */
+    void runWorker();
+
+    /** @brief Processes work items of the current job until there are none left. */
+    void processItems();
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable; ///< signals workers that generation changed or stopping is set
+    std::condition_variable jobDone; ///< signals the submitting thread that busyWorkers dropped to zero
+    size_t generation = 0; ///< incremented for every job
+    size_t openSlots = 0; ///< number of workers yet to join the current job
+    size_t busyWorkers = 0; ///< number of workers still processing the current job
+    bool stopping = false;
+
+    const std::function<void(size_t)>* work = nullptr; ///< the current job
+    size_t numItems = 0; ///< number of items of the current job
+    std::atomic<size_t> nextItem{0}; ///< index of the next unprocessed item of the current job
+    std::exception_ptr firstException; ///< first exception thrown by an item of the current job
+};
+
+} // namespace veins
@@ -0,0 +1,65 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/analogueModel/AttenuationTable.h"
+
+#include <cmath>
+
+using namespace veins;
+
+AttenuationTable::AttenuationTable(double minDistance, double maxDistance, double resolution, size_t numValues, Function function)
+    : minDistance(minDistance)
+    , maxDistance(maxDistance)
+    , resolution(resolution)
+    , numValues(numValues)
+{
+    ASSERT(resolution > 0);
+    ASSERT(maxDistance >= minDistance);
+
+    numRows = static_cast<size_t>(std::ceil((maxDistance - minDistance) / resolution)) + 1;
+    factors.resize(numRows * numValues);
+    for (size_t row = 0; row < numRows; row++) {
+        function(minDistance + row * resolution, &factors[row * numValues]);
+    }
+}
+
+void AttenuationTable::apply(double distance, double* values) const
+{
+    ASSERT(covers(distance));
+
+    double position = (distance - minDistance) / resolution;
+    size_t row = static_cast<size_t>(position);
+    if (row >= numRows - 1) {
+        const double* last = &factors[(numRows - 1) * numValues];
+        for (size_t i = 0; i < numValues; i++) {
+            values[i] *= last[i];
+        }
+        return;
+    }
+
+    double offset = position - row;
+    const double* lower = &factors[row * numValues];
+    const double* upper = lower + numValues;
+    for (size_t i = 0; i < numValues; i++) {
+        values[i] *= lower[i] + offset * (upper[i] - lower[i]);
+    }
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief Attenuation factors tabulated over distance, for analogue models whose attenuation only depends on distance (for a given configuration).
+ *
+ * The table holds one row of numValues factors (e.g., one per frequency of a Spectrum) for every multiple of the resolution between minDistance and maxDistance.
+ * Lookups interpolate linearly between the two neighboring rows.
+ * For a smooth attenuation function f, the interpolation error is bounded by resolution^2 / 8 * max|f''|,
+ * e.g., a relative error of resolution^2 / 8 * alpha * (alpha + 1) / d^2 for a power law pathloss d^-alpha.
+ *
+ * A default-constructed table covers no distance at all.
+ *
+ * @ingroup analogueModels
+ */
+class VEINS_API AttenuationTable {
+public:
+    /**
+     * Function computing numValues attenuation factors for a given distance into the passed array.
+     */
+    using Function = std::function<void(double distance, double* factors)>;
+
+    AttenuationTable() = default;
+
+    /**
+     * Tabulate the given function.
+     *
+     * @param minDistance smallest distance (in m) covered by the table
+     * @param maxDistance largest distance (in m) covered by the table
+     * @param resolution distance (in m) between two rows of the table
+     * @param numValues number of factors per row
+     * @param function the function to tabulate
+     */
+    AttenuationTable(double minDistance, double maxDistance, double resolution, size_t numValues, Function function);
+
+    /**
+     * Return whether the given distance lies within the range covered by the table.
+     */
+    bool covers(double distance) const
+    {
+        return distance >= minDistance && distance <= maxDistance && !factors.empty();
+    }
+
+    /**
+     * Multiply the (interpolated) attenuation factors for the given distance into the passed array of numValues values.
+     */
+    void apply(double distance, double* values) const;
+
+    /**
+     * Return the number of factors per row.
+     */
+    size_t getNumValues() const
+    {
+        return numValues;
+    }
+
+private:
+    double minDistance = 0;
+    double maxDistance = -1;
+    double resolution = 1;
+    size_t numValues = 0;
+    size_t numRows = 0;
+    std::vector<double> factors; ///< numRows rows of numValues factors each
+};
+
+} // namespace veins
@@ -29,6 +29,27 @@
 using namespace veins;
 using veins::AirFrame;
 
+constexpr double BreakpointPathlossModel::tableMinDistance;
+
+double BreakpointPathlossModel::computeAttenuation(double distance) const
+{
+    double attenuation = 1;
+    // PL(d) = PL0 + 10 alpha log10 (d/d0)
+    // 10 ^ { PL(d)/10 } = 10 ^{PL0 + 10 alpha log10 (d/d0)}/10
+    // 10 ^ { PL(d)/10 } = 10 ^ PL0/10 * 10 ^ { 10 log10 (d/d0)^alpha }/10
+    // 10 ^ { PL(d)/10 } = 10 ^ PL0/10 * 10 ^ { log10 (d/d0)^alpha }
+    // 10 ^ { PL(d)/10 } = 10 ^ PL0/10 * (d/d0)^alpha
+    if (distance < breakpointDistance) {
+        attenuation = attenuation * PL01_real;
+        attenuation = attenuation * pow(distance, alpha1);
+    }
+    else {
+        attenuation = attenuation * PL02_real;
+        attenuation = attenuation * pow(distance / breakpointDistance, alpha2);
+    }
+    return 1 / attenuation;
+}
+
 void BreakpointPathlossModel::filterSignal(Signal* signal)
 {
     auto senderPos = signal->getSenderPoa().pos.getPositionAt();
@@ -45,20 +66,12 @@ void BreakpointPathlossModel::filterSignal(Signal* signal)
     }
 
     double attenuation = 1;
-    // PL(d) = PL0 + 10 alpha log10 (d/d0)
-    // 10 ^ { PL(d)/10 } = 10 ^{PL0 + 10 alpha log10 (d/d0)}/10
-    // 10 ^ { PL(d)/10 } = 10 ^ PL0/10 * 10 ^ { 10 log10 (d/d0)^alpha }/10
-    // 10 ^ { PL(d)/10 } = 10 ^ PL0/10 * 10 ^ { log10 (d/d0)^alpha }
-    // 10 ^ { PL(d)/10 } = 10 ^ PL0/10 * (d/d0)^alpha
-    if (distance < breakpointDistance) {
-        attenuation = attenuation * PL01_real;
-        attenuation = attenuation * pow(distance, alpha1);
+    if (table.covers(distance)) {
+        table.apply(distance, &attenuation);
     }
     else {
-        attenuation = attenuation * PL02_real;
-        attenuation = attenuation * pow(distance / breakpointDistance, alpha2);
+        attenuation = computeAttenuation(distance);
     }
-    attenuation = 1 / attenuation;
     EV_TRACE << "attenuation is: " << attenuation << endl;
 
     pathlosses.record(10 * log10(attenuation)); // in dB
@@ -29,6 +29,7 @@
 #include "veins/veins.h"
 
 #include "veins/base/phyLayer/AnalogueModel.h"
+#include "veins/modules/analogueModel/AttenuationTable.h"
 
 using veins::AirFrame;
 
@@ -38,6 +39,11 @@ namespace veins {
  * @brief Basic implementation of a BreakpointPathlossModel.
  * This class can be used to implement the ieee802154 path loss model.
  *
+ * Optionally, attenuation can be looked up from an AttenuationTable instead of being computed for every Signal
+ * (parameters tableResolution and tableMaxDistance, in m; distances below 10 m are always computed exactly).
+ * The relative error of the table is bounded by tableResolution^2 / 8 * alpha * (alpha + 1) / d^2,
+ * except within one table step of the breakpoint distance, where the table interpolates between both pathloss regimes.
+ *
  * @ingroup analogueModels
  */
 class VEINS_API BreakpointPathlossModel : public AnalogueModel {
@@ -67,12 +73,23 @@ protected:
     /** logs computed pathlosses. */
     cOutVector pathlosses;
 
+    /** @brief tabulated attenuation (empty if disabled) */
+    AttenuationTable table;
+
+    /** @brief Computes the attenuation factor for the given distance (in m). */
+    double computeAttenuation(double distance) const;
+
 public:
+    /** @brief smallest distance (in m) for which the attenuation table is used */
+    static constexpr double tableMinDistance = 10;
+
     /**
      * @brief Initializes the analogue model. playgroundSize
      * need to be valid as long as this instance exists.
+     *
+     * If tableResolution is larger than 0, attenuation is tabulated with this resolution up to tableMaxDistance.
      */
-    BreakpointPathlossModel(cComponent* owner, double L01, double L02, double alpha1, double alpha2, double breakpointDistance, bool useTorus, const Coord& playgroundSize)
+    BreakpointPathlossModel(cComponent* owner, double L01, double L02, double alpha1, double alpha2, double breakpointDistance, bool useTorus, const Coord& playgroundSize, double tableResolution = 0, double tableMaxDistance = 0)
         : AnalogueModel(owner)
         , PL01(L01)
         , PL02(L02)
@@ -85,6 +102,9 @@ public:
         PL01_real = pow(10, PL01 / 10);
         PL02_real = pow(10, PL02 / 10);
         pathlosses.setName("pathlosses");
+        if (tableResolution > 0 && tableMaxDistance > tableMinDistance) {
+            table = AttenuationTable(tableMinDistance, tableMaxDistance, tableResolution, 1, [this](double distance, double* factor) { *factor = computeAttenuation(distance); });
+        }
     }
 
     /**
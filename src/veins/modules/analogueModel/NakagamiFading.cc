@@ -25,13 +25,20 @@
 
 using namespace veins;
 
+constexpr bool NakagamiFading::readsSignalPower;
+
 /**
  * Simple Nakagami-m fading (based on a constant factor across all time and frequencies).
  */
 void NakagamiFading::filterSignal(Signal* signal)
 {
-    auto senderPos = signal->getSenderPoa().pos.getPositionAt();
-    auto receiverPos = signal->getReceiverPoa().pos.getPositionAt();
+    computeLinkAttenuation(*signal).applyTo(signal->getValues(), signal->getNumValues());
+}
+
+LinkAttenuation NakagamiFading::computeLinkAttenuation(const Signal& signal)
+{
+    auto senderPos = signal.getSenderPoa().pos.getPositionAt();
+    auto receiverPos = signal.getReceiverPoa().pos.getPositionAt();
 
     const double M_CLOSE = 1.5;
     const double M_FAR = 0.75;
@@ -42,7 +49,7 @@ void NakagamiFading::filterSignal(Signal* signal)
     // get average TX power
     // FIXME: really use average power (instead of max)
     EV_TRACE << "Finding max TX power ..." << endl;
-    double sendPower_mW = signal->getMax();
+    double sendPower_mW = signal.getMax();
     EV_TRACE << "TX power is " << FWMath::mW2dBm(sendPower_mW) << " dBm" << endl;
 
     // get m value
@@ -57,15 +64,22 @@ void NakagamiFading::filterSignal(Signal* signal)
     }
 
     // calculate average RX power
-    double recvPower_mW = (RNGCONTEXT gamma_d(m, sendPower_mW / 1000 / m)) * 1000.0;
+    double recvPower_mW;
+    if (signal.hasRandomStream()) {
+        recvPower_mW = signal.getRandomStream().gamma(m, sendPower_mW / 1000 / m) * 1000.0;
+    }
+    else {
+        recvPower_mW = (RNGCONTEXT gamma_d(m, sendPower_mW / 1000 / m)) * 1000.0;
+    }
     if (recvPower_mW > sendPower_mW) {
         recvPower_mW = sendPower_mW;
     }
     EV_TRACE << "RX power is " << FWMath::mW2dBm(recvPower_mW) << " dBm" << endl;
 
     // infer average attenuation
-    double factor = recvPower_mW / sendPower_mW;
-    EV_TRACE << "factor is: " << factor << " (i.e. " << FWMath::mW2dBm(factor) << " dB)" << endl;
+    LinkAttenuation attenuation;
+    attenuation.factor = recvPower_mW / sendPower_mW;
+    EV_TRACE << "factor is: " << attenuation.factor << " (i.e. " << FWMath::mW2dBm(attenuation.factor) << " dB)" << endl;
 
-    *signal *= factor;
+    return attenuation;
 }
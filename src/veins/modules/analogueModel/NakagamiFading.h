@@ -58,6 +58,26 @@ public:
 
     void filterSignal(Signal* signal) override;
 
+    /**
+     * @brief Whether computeLinkAttenuation depends on the power the Signal has when it is called (see StaticAnalogueModelChain).
+     */
+    static constexpr bool readsSignalPower = true;
+
+    /**
+     * @brief Computes the attenuation filterSignal applies to the Signal, without applying it.
+     */
+    LinkAttenuation computeLinkAttenuation(const Signal& signal);
+
+    bool isStateless() override
+    {
+        return true;
+    }
+
+    bool isThreadSafe() override
+    {
+        return true;
+    }
+
 protected:
     /** @brief Whether to use a constant m or a m based on distance */
     bool constM;
@@ -55,6 +55,11 @@ public:
     }
 
     void filterSignal(Signal*) override;
+
+    bool isStateless() override
+    {
+        return true;
+    }
 };
 
 } // namespace veins
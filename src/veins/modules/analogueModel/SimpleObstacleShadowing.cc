@@ -26,6 +26,8 @@ using namespace veins;
 
 using veins::AirFrame;
 
+constexpr bool SimpleObstacleShadowing::readsSignalPower;
+
 SimpleObstacleShadowing::SimpleObstacleShadowing(cComponent* owner, ObstacleControl& obstacleControl, bool useTorus, const Coord& playgroundSize)
     : AnalogueModel(owner)
     , obstacleControl(obstacleControl)
@@ -35,14 +37,30 @@ SimpleObstacleShadowing::SimpleObstacleShadowing(cComponent* owner, ObstacleCont
     if (useTorus) throw cRuntimeError("SimpleObstacleShadowing does not work on torus-shaped playgrounds");
 }
 
+void SimpleObstacleShadowing::prepareConcurrentFiltering(const Signal& signal)
+{
+    obstacleControl.prepareConcurrentAccess();
+}
+
+uint64_t SimpleObstacleShadowing::getGeneration()
+{
+    return obstacleControl.getGeneration();
+}
+
 void SimpleObstacleShadowing::filterSignal(Signal* signal)
 {
-    auto senderPos = signal->getSenderPoa().pos.getPositionAt();
-    auto receiverPos = signal->getReceiverPoa().pos.getPositionAt();
+    computeLinkAttenuation(*signal).applyTo(signal->getValues(), signal->getNumValues());
+}
+
+LinkAttenuation SimpleObstacleShadowing::computeLinkAttenuation(const Signal& signal)
+{
+    auto senderPos = signal.getSenderPoa().pos.getPositionAt();
+    auto receiverPos = signal.getReceiverPoa().pos.getPositionAt();
 
-    double factor = obstacleControl.calculateAttenuation(senderPos, receiverPos);
+    LinkAttenuation attenuation;
+    attenuation.factor = obstacleControl.calculateAttenuation(senderPos, receiverPos);
 
-    EV_TRACE << "value is: " << factor << endl;
+    EV_TRACE << "value is: " << attenuation.factor << endl;
 
-    *signal *= factor;
+    return attenuation;
 }
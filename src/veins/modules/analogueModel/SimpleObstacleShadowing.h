@@ -74,10 +74,39 @@ public:
      */
     void filterSignal(Signal* signal) override;
 
+    /**
+     * @brief Whether computeLinkAttenuation depends on the power the Signal has when it is called (see StaticAnalogueModelChain).
+     */
+    static constexpr bool readsSignalPower = false;
+
+    /**
+     * @brief Computes the attenuation filterSignal applies to the Signal, without applying it.
+     */
+    LinkAttenuation computeLinkAttenuation(const Signal& signal);
+
     bool neverIncreasesPower() override
     {
         return true;
     }
+
+    bool isStateless() override
+    {
+        return true;
+    }
+
+    bool isDeterministic() override
+    {
+        return true;
+    }
+
+    uint64_t getGeneration() override;
+
+    bool isThreadSafe() override
+    {
+        return true;
+    }
+
+    void prepareConcurrentFiltering(const Signal& signal) override;
 };
 
 } // namespace veins
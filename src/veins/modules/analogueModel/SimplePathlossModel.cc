@@ -30,29 +30,52 @@ using namespace veins;
 
 using veins::AirFrame;
 
+const std::vector<double>& SimplePathlossModel::getWavelengthFactors(const Spectrum& spectrum)
+{
+    if (!(spectrum == cachedSpectrum) || wavelengthFactors.size() != spectrum.getNumFreqs()) {
+        wavelengthFactors.resize(spectrum.getNumFreqs());
+        for (size_t i = 0; i < spectrum.getNumFreqs(); i++) {
+            double wavelength = BaseWorldUtility::speedOfLight() / spectrum.freqAt(i);
+            wavelengthFactors[i] = (wavelength * wavelength) / (16.0 * M_PI * M_PI);
+        }
+        cachedSpectrum = spectrum;
+    }
+    return wavelengthFactors;
+}
+
+void SimplePathlossModel::prepareConcurrentFiltering(const Signal& signal)
+{
+    getWavelengthFactors(signal.getSpectrum());
+}
+
+constexpr bool SimplePathlossModel::readsSignalPower;
+
 void SimplePathlossModel::filterSignal(Signal* signal)
 {
-    auto senderPos = signal->getSenderPoa().pos.getPositionAt();
-    auto receiverPos = signal->getReceiverPoa().pos.getPositionAt();
+    computeLinkAttenuation(*signal).applyTo(signal->getValues(), signal->getNumValues());
+}
+
+LinkAttenuation SimplePathlossModel::computeLinkAttenuation(const Signal& signal)
+{
+    auto senderPos = signal.getSenderPoa().pos.getPositionAt();
+    auto receiverPos = signal.getReceiverPoa().pos.getPositionAt();
 
     /** Calculate the distance factor */
     double sqrDistance = useTorus ? receiverPos.sqrTorusDist(senderPos, playgroundSize) : receiverPos.sqrdist(senderPos);
 
     EV_TRACE << "sqrdistance is: " << sqrDistance << endl;
 
+    LinkAttenuation attenuation;
     if (sqrDistance <= 1.0) {
         // attenuation is negligible
-        return;
+        return attenuation;
     }
 
     // the part of the attenuation only depending on the distance
-    double distFactor = pow(sqrDistance, -pathLossAlphaHalf) / (16.0 * M_PI * M_PI);
-    EV_TRACE << "distance factor is: " << distFactor << endl;
+    double distFactor = pow(sqrDistance, -pathLossAlphaHalf);
+    EV_TRACE << "distance factor is: " << distFactor / (16.0 * M_PI * M_PI) << endl;
 
-    Signal attenuation(signal->getSpectrum());
-    for (uint16_t i = 0; i < signal->getNumValues(); i++) {
-        double wavelength = BaseWorldUtility::speedOfLight() / signal->getSpectrum().freqAt(i);
-        attenuation.at(i) = (wavelength * wavelength) * distFactor;
-    }
-    *signal *= attenuation;
+    attenuation.perFrequency = getWavelengthFactors(signal.getSpectrum()).data();
+    attenuation.factor = distFactor;
+    return attenuation;
 }
@@ -30,6 +30,7 @@
 
 #include "veins/base/phyLayer/AnalogueModel.h"
 #include "veins/base/modules/BaseWorldUtility.h"
+#include "veins/base/toolbox/Spectrum.h"
 
 namespace veins {
 
@@ -62,6 +63,17 @@ protected:
     /** @brief The size of the playground.*/
     const Coord& playgroundSize;
 
+    /** @brief The Spectrum wavelengthFactors have been computed for. */
+    Spectrum cachedSpectrum;
+
+    /** @brief Squared wavelength divided by (4 pi)^2 for each frequency of cachedSpectrum. */
+    std::vector<double> wavelengthFactors;
+
+    /**
+     * @brief Returns the wavelength-dependent factors for the given Spectrum, computing them on first use.
+     */
+    const std::vector<double>& getWavelengthFactors(const Spectrum& spectrum);
+
 public:
     /**
      * @brief Initializes the analogue model. playgroundSize
@@ -91,10 +103,37 @@ public:
      */
     void filterSignal(Signal*) override;
 
+    /**
+     * @brief Whether computeLinkAttenuation depends on the power the Signal has when it is called (see StaticAnalogueModelChain).
+     */
+    static constexpr bool readsSignalPower = false;
+
+    /**
+     * @brief Computes the attenuation filterSignal applies to the Signal, without applying it.
+     */
+    LinkAttenuation computeLinkAttenuation(const Signal& signal);
+
     bool neverIncreasesPower() override
     {
         return true;
     }
+
+    bool isStateless() override
+    {
+        return true;
+    }
+
+    bool isDeterministic() override
+    {
+        return true;
+    }
+
+    bool isThreadSafe() override
+    {
+        return true;
+    }
+
+    void prepareConcurrentFiltering(const Signal& signal) override;
 };
 
 } // namespace veins
@@ -0,0 +1,192 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/base/phyLayer/AnalogueModel.h"
+#include "veins/base/toolbox/Signal.h"
+#include "veins/modules/analogueModel/NakagamiFading.h"
+#include "veins/modules/analogueModel/SimpleObstacleShadowing.h"
+#include "veins/modules/analogueModel/SimplePathlossModel.h"
+
+namespace veins {
+
+/**
+ * @brief A sequence of analogue models fixed at compile time, applied as a single model.
+ *
+ * Each model type needs to provide a non-virtual computeLinkAttenuation and a static readsSignalPower flag.
+ * The attenuations of consecutive models are multiplied into the Signal in a single loop over its values,
+ * multiplying in the same order as if the models were applied one after another, so results are identical.
+ * Only models with readsSignalPower set (e.g., NakagamiFading) need the preceding models to be applied first.
+ *
+ * @ingroup analogueModels
+ */
+template <typename... Models>
+class StaticAnalogueModelChain : public AnalogueModel {
+public:
+    StaticAnalogueModelChain(cComponent* owner, std::unique_ptr<Models>... models)
+        : AnalogueModel(owner)
+        , models(std::move(models)...)
+    {
+        listModels<0>();
+    }
+
+    void filterSignal(Signal* signal) override
+    {
+        LinkAttenuation pending[sizeof...(Models)];
+        size_t numPending = 0;
+        filterFrom<0>(*signal, pending, numPending);
+        applyPending(*signal, pending, numPending);
+    }
+
+    bool neverIncreasesPower() override
+    {
+        return allModels(&AnalogueModel::neverIncreasesPower);
+    }
+
+    bool isStateless() override
+    {
+        return allModels(&AnalogueModel::isStateless);
+    }
+
+    bool isDeterministic() override
+    {
+        return allModels(&AnalogueModel::isDeterministic);
+    }
+
+    bool isThreadSafe() override
+    {
+        return allModels(&AnalogueModel::isThreadSafe);
+    }
+
+    uint64_t getGeneration() override
+    {
+        uint64_t generation = 0;
+        for (auto model : modelList) {
+            generation += model->getGeneration();
+        }
+        return generation;
+    }
+
+    void prepareConcurrentFiltering(const Signal& signal) override
+    {
+        for (auto model : modelList) {
+            model->prepareConcurrentFiltering(signal);
+        }
+    }
+
+    void setOwner(cComponent* newOwner) override
+    {
+        AnalogueModel::setOwner(newOwner);
+        for (auto model : modelList) {
+            model->setOwner(newOwner);
+        }
+    }
+
+protected:
+    std::tuple<std::unique_ptr<Models>...> models;
+
+    /** @brief The models in order, for calls that are not performance critical. */
+    std::vector<AnalogueModel*> modelList;
+
+    template <size_t I>
+    typename std::enable_if<(I < sizeof...(Models))>::type listModels()
+    {
+        modelList.push_back(std::get<I>(models).get());
+        listModels<I + 1>();
+    }
+
+    template <size_t I>
+    typename std::enable_if<(I == sizeof...(Models))>::type listModels()
+    {
+    }
+
+    /**
+     * @brief Computes the attenuations of models I and following, applying pending attenuations whenever a model needs the Signal's current power.
+     */
+    template <size_t I>
+    typename std::enable_if<(I < sizeof...(Models))>::type filterFrom(Signal& signal, LinkAttenuation* pending, size_t& numPending)
+    {
+        using Model = typename std::tuple_element<I, std::tuple<Models...>>::type;
+        if (Model::readsSignalPower) {
+            applyPending(signal, pending, numPending);
+        }
+        pending[numPending++] = std::get<I>(models)->computeLinkAttenuation(signal);
+        filterFrom<I + 1>(signal, pending, numPending);
+    }
+
+    template <size_t I>
+    typename std::enable_if<(I == sizeof...(Models))>::type filterFrom(Signal& signal, LinkAttenuation* pending, size_t& numPending)
+    {
+    }
+
+    /**
+     * @brief Multiplies all pending attenuations into the Signal in one pass, then clears them.
+     */
+    static void applyPending(Signal& signal, const LinkAttenuation* pending, size_t& numPending)
+    {
+        if (numPending == 0) return;
+
+        double* values = signal.getValues();
+        for (size_t i = 0; i < signal.getNumValues(); i++) {
+            double value = values[i];
+            for (size_t m = 0; m < numPending; m++) {
+                value = pending[m].applyTo(value, i);
+            }
+            values[i] = value;
+        }
+        numPending = 0;
+    }
+
+    bool allModels(bool (AnalogueModel::*property)()) const
+    {
+        for (auto model : modelList) {
+            if (!(model->*property)()) return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief SimplePathlossModel, SimpleObstacleShadowing, and NakagamiFading as one StaticAnalogueModelChain.
+ *
+ * An example config.xml for this AnalogueModel can be the following:
+ * @verbatim
+    <AnalogueModel type="SimplePathlossObstacleNakagamiChain">
+        <!-- parameters of SimplePathlossModel and NakagamiFading -->
+        <parameter name="alpha" type="double" value="2.0"/>
+        <parameter name="constM" type="bool" value="false"/>
+    </AnalogueModel>
+   @endverbatim
+ *
+ * @ingroup analogueModels
+ */
+using SimplePathlossObstacleNakagamiChain = StaticAnalogueModelChain<SimplePathlossModel, SimpleObstacleShadowing, NakagamiFading>;
+
+} // namespace veins
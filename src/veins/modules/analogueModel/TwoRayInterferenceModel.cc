@@ -21,10 +21,85 @@
 //
 
 #include "veins/modules/analogueModel/TwoRayInterferenceModel.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "veins/base/messages/AirFrame_m.h"
 
 using namespace veins;
 
+constexpr double TwoRayInterferenceModel::tableMinDistance;
+
+void TwoRayInterferenceModel::updateSpectrumFactors(const Spectrum& spectrum)
+{
+    if (spectrum == cachedSpectrum && waveNumbers.size() == spectrum.getNumFreqs()) return;
+
+    waveNumbers.resize(spectrum.getNumFreqs());
+    pathlossFactors.resize(spectrum.getNumFreqs());
+    for (size_t i = 0; i < spectrum.getNumFreqs(); i++) {
+        double lambda = BaseWorldUtility::speedOfLight() / spectrum.freqAt(i);
+        waveNumbers[i] = 2 * M_PI / lambda;
+        pathlossFactors[i] = pow(lambda / (4 * M_PI), 2);
+    }
+    cachedSpectrum = spectrum;
+}
+
+void TwoRayInterferenceModel::attenuate(const Spectrum& spectrum, double d, double ht, double hr, double* values)
+{
+    updateSpectrumFactors(spectrum);
+
+    double d_dir = sqrt(pow(d, 2) + pow((ht - hr), 2)); // direct distance
+    double d_ref = sqrt(pow(d, 2) + pow((ht + hr), 2)); // distance via ground reflection
+    double sin_theta = (ht + hr) / d_ref;
+    double cos_theta = d / d_ref;
+
+    double gamma = (sin_theta - sqrt(epsilon_r - pow(cos_theta, 2))) / (sin_theta + sqrt(epsilon_r - pow(cos_theta, 2)));
+
+    // (1 + gamma cos(phi))^2 + gamma^2 sin(phi)^2 == 1 + 2 gamma cos(phi) + gamma^2
+    double gammaSquaredPlusOne = 1 + gamma * gamma;
+    double inverseSquaredDistance = 1 / (d * d);
+
+    for (size_t i = 0; i < spectrum.getNumFreqs(); i++) {
+        double phi = waveNumbers[i] * (d_dir - d_ref);
+        double factor = (gammaSquaredPlusOne + 2 * gamma * cos(phi)) * pathlossFactors[i] * inverseSquaredDistance;
+
+        EV_TRACE << "Add attenuation for (freq, phi, gamma, att) = (" << spectrum.freqAt(i) << ", " << phi << ", " << gamma << ", " << factor << ", " << FWMath::mW2dBm(1 / factor) << ")" << endl;
+
+        values[i] *= factor;
+    }
+}
+
+std::shared_ptr<const AttenuationTable> TwoRayInterferenceModel::getTable(const Spectrum& spectrum, double ht, double hr)
+{
+    const TableKey key{spectrum.getId(), std::llround(ht / tableHeightResolution), std::llround(hr / tableHeightResolution)};
+
+    std::lock_guard<std::mutex> lock(tablesMutex);
+    if (auto table = tables.find(key)) {
+        return *table;
+    }
+
+    // tabulate for the rounded heights, so results do not depend on which height of a step came first
+    const double tableHt = key.ht * tableHeightResolution;
+    const double tableHr = key.hr * tableHeightResolution;
+    EV_TRACE << "Building attenuation table for (ht, hr) = (" << tableHt << ", " << tableHr << ")" << endl;
+    auto function = [this, &spectrum, tableHt, tableHr](double d, double* factors) {
+        std::fill(factors, factors + spectrum.getNumFreqs(), 1.0);
+        attenuate(spectrum, d, tableHt, tableHr, factors);
+    };
+    auto table = std::make_shared<const AttenuationTable>(tableMinDistance, tableMaxDistance, tableResolution, spectrum.getNumFreqs(), function);
+    tables.insert(key, table);
+    return table;
+}
+
+void TwoRayInterferenceModel::prepareConcurrentFiltering(const Signal& signal)
+{
+    updateSpectrumFactors(signal.getSpectrum());
+    if (tableResolution > 0) {
+        getTable(signal.getSpectrum(), signal.getSenderPoa().pos.getPositionAt().z, signal.getReceiverPoa().pos.getPositionAt().z);
+    }
+}
+
 void TwoRayInterferenceModel::filterSignal(Signal* signal)
 {
     auto senderPos = signal->getSenderPoa().pos.getPositionAt();
@@ -41,23 +116,10 @@ void TwoRayInterferenceModel::filterSignal(Signal* signal)
 
     EV_TRACE << "(ht, hr) = (" << ht << ", " << hr << ")" << endl;
 
-    double d_dir = sqrt(pow(d, 2) + pow((ht - hr), 2)); // direct distance
-    double d_ref = sqrt(pow(d, 2) + pow((ht + hr), 2)); // distance via ground reflection
-    double sin_theta = (ht + hr) / d_ref;
-    double cos_theta = d / d_ref;
-
-    double gamma = (sin_theta - sqrt(epsilon_r - pow(cos_theta, 2))) / (sin_theta + sqrt(epsilon_r - pow(cos_theta, 2)));
-
-    Signal attenuation(signal->getSpectrum());
-    for (uint16_t i = 0; i < signal->getNumValues(); i++) {
-        double freq = signal->getSpectrum().freqAt(i);
-        double lambda = BaseWorldUtility::speedOfLight() / freq;
-        double phi = (2 * M_PI / lambda * (d_dir - d_ref));
-        double att = pow(4 * M_PI * (d / lambda) * 1 / (sqrt((pow((1 + gamma * cos(phi)), 2) + pow(gamma, 2) * pow(sin(phi), 2)))), 2);
-
-        EV_TRACE << "Add attenuation for (freq, lambda, phi, gamma, att) = (" << freq << ", " << lambda << ", " << phi << ", " << gamma << ", " << (1 / att) << ", " << FWMath::mW2dBm(att) << ")" << endl;
-
-        attenuation.at(i) = 1 / att;
+    if (tableResolution > 0 && d >= tableMinDistance && d <= tableMaxDistance) {
+        getTable(signal->getSpectrum(), ht, hr)->apply(d, signal->getValues());
+        return;
     }
-    *signal *= attenuation;
+
+    attenuate(signal->getSpectrum(), d, ht, hr, signal->getValues());
 }
@@ -22,8 +22,16 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "veins/base/phyLayer/AnalogueModel.h"
 #include "veins/base/modules/BaseWorldUtility.h"
+#include "veins/base/toolbox/Spectrum.h"
+#include "veins/modules/analogueModel/AttenuationTable.h"
+#include "veins/modules/utility/LruCache.h"
 
 namespace veins {
 
@@ -38,6 +46,27 @@ using veins::AirFrame;
  * An in-depth description of the model is available at:
  * Christoph Sommer and Falko Dressler, "Using the Right Two-Ray Model? A Measurement based Evaluation of PHY Models in VANETs," Proceedings of 17th ACM International Conference on Mobile Computing and Networking (MobiCom 2011), Poster Session, Las Vegas, NV, September 2011.
  *
+ * Wavelength-dependent terms are computed once per Spectrum.
+ * Optionally, attenuation can be looked up from an AttenuationTable (one per Spectrum and pair of antenna heights) instead of being computed for every Signal.
+ * Distances below 10 m are always computed exactly.
+ * With a table resolution of 0.1 m, the deviation from the exact model stays below 0.05 dB for typical vehicular antenna heights at 5.9 GHz;
+ * it grows with the square of the resolution (approx. 0.35 dB at 0.5 m).
+ * Antenna heights are rounded to TableHeightResolution (1 mm by default, adding up to 0.04 dB close to the model's deep fades),
+ * and only the TableCacheSize most recently used tables (of about 1.7 MB each for 2000 m at 0.1 m and one frequency) are kept.
+ *
+ * An example config.xml for this AnalogueModel can be the following:
+ * @verbatim
+    <AnalogueModel type="TwoRayInterferenceModel">
+        <parameter name="DielectricConstant" type="double" value="1.02"/>
+        <!-- Optional: tabulate attenuation in steps of 0.1 m up to a distance of 2000 m -->
+        <parameter name="TableResolution" type="double" value="0.1"/>
+        <parameter name="TableMaxDistance" type="double" value="2000"/>
+        <!-- Optional: round antenna heights to 1 mm and keep up to 8 tables -->
+        <parameter name="TableHeightResolution" type="double" value="0.001"/>
+        <parameter name="TableCacheSize" type="long" value="8"/>
+    </AnalogueModel>
+   @endverbatim
+ *
  * @author Stefan Joerer
  *
  * @ingroup analogueModels
@@ -45,10 +74,23 @@ using veins::AirFrame;
 class VEINS_API TwoRayInterferenceModel : public AnalogueModel {
 
 public:
-    TwoRayInterferenceModel(cComponent* owner, double dielectricConstant)
+    /**
+     * @param owner pointer to the cComponent that owns this AnalogueModel
+     * @param dielectricConstant dielectric constant of the ground
+     * @param tableResolution distance (in m) between entries of the attenuation tables, or 0 to always compute attenuation exactly
+     * @param tableMaxDistance largest distance (in m) to tabulate attenuation for
+     * @param tableHeightResolution step (in m) antenna heights are rounded to before looking up their table
+     * @param tableCacheSize largest number of attenuation tables to keep
+     */
+    TwoRayInterferenceModel(cComponent* owner, double dielectricConstant, double tableResolution = 0, double tableMaxDistance = 0, double tableHeightResolution = 0.001, size_t tableCacheSize = 8)
         : AnalogueModel(owner)
         , epsilon_r(dielectricConstant)
+        , tableResolution(tableResolution)
+        , tableMaxDistance(tableMaxDistance)
+        , tableHeightResolution(tableHeightResolution)
+        , tables(tableCacheSize)
     {
+        ASSERT(tableHeightResolution > 0);
     }
 
     ~TwoRayInterferenceModel() override
@@ -57,9 +99,91 @@ public:
 
     void filterSignal(Signal* signal) override;
 
+    bool isStateless() override
+    {
+        return true;
+    }
+
+    bool isDeterministic() override
+    {
+        return true;
+    }
+
+    bool isThreadSafe() override
+    {
+        return true;
+    }
+
+    void prepareConcurrentFiltering(const Signal& signal) override;
+
+    /** @brief smallest distance (in m) for which attenuation tables are used */
+    static constexpr double tableMinDistance = 10;
+
 protected:
+    /**
+     * @brief Multiplies the attenuation for the given distance (2D) and antenna heights into the values of the given spectrum.
+     */
+    void attenuate(const Spectrum& spectrum, double d, double ht, double hr, double* values);
+
+    /**
+     * @brief Updates waveNumbers and pathlossFactors if they have not been computed for the given Spectrum yet.
+     */
+    void updateSpectrumFactors(const Spectrum& spectrum);
+
+    /**
+     * @brief Returns the attenuation table for the given Spectrum and (rounded) antenna heights, creating it if it is not cached.
+     */
+    std::shared_ptr<const AttenuationTable> getTable(const Spectrum& spectrum, double ht, double hr);
+
+    /** @brief Spectrum and antenna heights (in multiples of tableHeightResolution) of an attenuation table. */
+    struct TableKey {
+        const void* spectrum;
+        int64_t ht;
+        int64_t hr;
+
+        bool operator==(const TableKey& o) const
+        {
+            return spectrum == o.spectrum && ht == o.ht && hr == o.hr;
+        }
+
+        struct Hash {
+            size_t operator()(const TableKey& k) const
+            {
+                size_t h = std::hash<const void*>()(k.spectrum);
+                for (int64_t v : {k.ht, k.hr}) {
+                    h ^= std::hash<int64_t>()(v) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+                }
+                return h;
+            }
+        };
+    };
+
     /** @brief stores the dielectric constant used for calculation */
     double epsilon_r;
+
+    /** @brief resolution of attenuation tables (0 if disabled) */
+    double tableResolution;
+
+    /** @brief largest distance covered by attenuation tables */
+    double tableMaxDistance;
+
+    /** @brief step antenna heights are rounded to before looking up their attenuation table */
+    double tableHeightResolution;
+
+    /** @brief The Spectrum waveNumbers and pathlossFactors have been computed for. */
+    Spectrum cachedSpectrum;
+
+    /** @brief 2 pi / lambda for each frequency of cachedSpectrum */
+    std::vector<double> waveNumbers;
+
+    /** @brief (lambda / (4 pi))^2 for each frequency of cachedSpectrum */
+    std::vector<double> pathlossFactors;
+
+    /** @brief most recently used attenuation tables; shared, so tables stay valid while in use on other threads after being evicted */
+    LruCache<TableKey, std::shared_ptr<const AttenuationTable>, TableKey::Hash> tables;
+
+    /** @brief guards tables, as the model may be shared by PHYs filtering signals concurrently */
+    std::mutex tablesMutex;
 };
 
 } // namespace veins
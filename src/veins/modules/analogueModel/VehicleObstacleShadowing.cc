@@ -33,6 +33,20 @@ VehicleObstacleShadowing::VehicleObstacleShadowing(cComponent* owner, VehicleObs
     if (useTorus) throw cRuntimeError("VehicleObstacleShadowing does not work on torus-shaped playgrounds");
 }
 
+const std::vector<double>& VehicleObstacleShadowing::getInvSqrtWavelengths(const Spectrum& spectrum)
+{
+    if (!(spectrum == cachedSpectrum) || invSqrtWavelengths.size() != spectrum.getNumFreqs()) {
+        invSqrtWavelengths = VehicleObstacleControl::getInvSqrtWavelengths(spectrum);
+        cachedSpectrum = spectrum;
+    }
+    return invSqrtWavelengths;
+}
+
+void VehicleObstacleShadowing::prepareConcurrentFiltering(const Signal& signal)
+{
+    getInvSqrtWavelengths(signal.getSpectrum());
+}
+
 void VehicleObstacleShadowing::filterSignal(Signal* signal)
 {
     auto senderPos = signal->getSenderPoa().pos.getPositionAt();
@@ -47,15 +61,7 @@ void VehicleObstacleShadowing::filterSignal(Signal* signal)
     potentialObstacles.insert(potentialObstacles.begin(), std::make_pair(0, senderHeight));
     potentialObstacles.emplace_back(senderPos.distance(receiverPos), receiverHeight);
 
-    auto attenuationDB = VehicleObstacleControl::getVehicleAttenuationDZ(potentialObstacles, Signal(signal->getSpectrum()));
-
-    EV_TRACE << "t=" << simTime() << ": Attenuation by vehicles is " << attenuationDB << std::endl;
-
-    // convert from "dB loss" to a multiplicative factor
-    Signal attenuation(attenuationDB.getSpectrum());
-    for (uint16_t i = 0; i < attenuation.getNumValues(); i++) {
-        attenuation.at(i) = pow(10.0, -attenuationDB.at(i) / 10.0);
-    }
+    EV_TRACE << "t=" << simTime() << ": " << potentialObstacles.size() - 2 << " vehicles between sender and receiver" << std::endl;
 
-    *signal *= attenuation;
+    VehicleObstacleControl::attenuateByVehicles(potentialObstacles, getInvSqrtWavelengths(signal->getSpectrum()), signal->getValues());
 }
@@ -24,6 +24,7 @@
 
 #include "veins/base/phyLayer/AnalogueModel.h"
 #include "veins/base/modules/BaseWorldUtility.h"
+#include "veins/base/toolbox/Spectrum.h"
 #include "veins/modules/obstacle/VehicleObstacleControl.h"
 #include "veins/base/utils/Move.h"
 #include "veins/base/messages/AirFrame_m.h"
@@ -52,6 +53,17 @@ protected:
     /** @brief The size of the playground.*/
     const Coord& playgroundSize;
 
+    /** @brief The Spectrum invSqrtWavelengths have been computed for. */
+    Spectrum cachedSpectrum;
+
+    /** @brief 1 / sqrt(lambda) for each frequency of cachedSpectrum. */
+    std::vector<double> invSqrtWavelengths;
+
+    /**
+     * @brief Returns 1 / sqrt(lambda) for each frequency of the given Spectrum, computing them on first use.
+     */
+    const std::vector<double>& getInvSqrtWavelengths(const Spectrum& spectrum);
+
 public:
     /**
      * @brief Initializes the analogue model. myMove and playgroundSize
@@ -73,10 +85,22 @@ public:
      */
     void filterSignal(Signal* signal) override;
 
+    void prepareConcurrentFiltering(const Signal& signal) override;
+
     bool neverIncreasesPower() override
     {
         return true;
     }
+
+    bool isStateless() override
+    {
+        return true;
+    }
+
+    bool isThreadSafe() override
+    {
+        return true;
+    }
 };
 
 } // namespace veins
@@ -0,0 +1,102 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/application/ieee80211p/BeaconScheduler.h"
+
+#include "veins/modules/application/ieee80211p/DemoBaseApplLayer.h"
+
+using namespace veins;
+
+Define_Module(veins::BeaconScheduler);
+
+BeaconScheduler::BeaconScheduler()
+    : nextSerial(0)
+    , firing(false)
+    , wakeup(new cMessage("beacon scheduler wakeup"))
+{
+}
+
+BeaconScheduler::~BeaconScheduler()
+{
+    cancelAndDelete(wakeup);
+}
+
+void BeaconScheduler::initialize()
+{
+    simtime_t slotLength = par("slotLength");
+    int numSlots = par("numSlots");
+    if (slotLength <= 0) throw cRuntimeError("slotLength must be positive");
+    if (numSlots <= 0) throw cRuntimeError("numSlots must be positive");
+    wheel = make_unique<TimingWheel<Event>>(slotLength.raw(), numSlots);
+}
+
+void BeaconScheduler::schedule(DemoBaseApplLayer* app, cMessage* msg, simtime_t time)
+{
+    Enter_Method_Silent();
+    ASSERT(wheel);
+    if (time < simTime()) throw cRuntimeError("Cannot schedule %s in the past", msg->getName());
+
+    uint64_t serial = nextSerial++;
+    pending[msg] = {app->getId(), serial};
+    wheel->insert(time.raw(), {app->getId(), app, msg, serial});
+    if (!firing && (!wakeup->isScheduled() || time < wakeup->getArrivalTime())) {
+        rearm();
+    }
+}
+
+void BeaconScheduler::cancel(cMessage* msg)
+{
+    // the event stays in the wheel and is skipped once it is due
+    pending.erase(msg);
+}
+
+bool BeaconScheduler::isPending(const DemoBaseApplLayer* app, cMessage* msg) const
+{
+    auto it = pending.find(msg);
+    return it != pending.end() && it->second.moduleId == app->getId();
+}
+
+void BeaconScheduler::handleMessage(cMessage* msg)
+{
+    ASSERT(msg == wakeup);
+    int64_t now = simTime().raw();
+
+    firing = true;
+    while (!wheel->empty() && wheel->nextTime() == now) {
+        Event event = wheel->pop().second;
+        auto it = pending.find(event.msg);
+        if (it == pending.end() || it->second.serial != event.serial) continue;
+        pending.erase(it);
+        // the app (and with it, its messages) may have been deleted
+        if (getSimulation()->getModule(event.moduleId) != static_cast<cModule*>(event.app)) continue;
+        event.app->handlePeriodicEvent(event.msg);
+    }
+    firing = false;
+    rearm();
+}
+
+void BeaconScheduler::rearm()
+{
+    if (wakeup->isScheduled()) cancelEvent(wakeup);
+    if (wheel->empty()) return;
+    scheduleAt(SimTime().setRaw(wheel->nextTime()), wakeup);
+}
@@ -0,0 +1,97 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <unordered_map>
+
+#include "veins/veins.h"
+
+#include "veins/modules/utility/TimingWheel.h"
+
+namespace veins {
+
+class DemoBaseApplLayer;
+
+/**
+ * Fires the periodic events (beacons, service advertisements) of all DemoBaseApplLayer modules with a single self-message.
+ *
+ * Pending events are kept in a TimingWheel instead of the future event set, so the FES only ever holds one entry for them,
+ * no matter how many vehicles there are. Each event still fires at exactly the time it was scheduled for.
+ *
+ * DemoBaseApplLayer modules whose beaconSchedulerModule parameter points to this module use it instead of scheduling their own self-messages.
+ */
+class VEINS_API BeaconScheduler : public cSimpleModule {
+public:
+    BeaconScheduler();
+    ~BeaconScheduler() override;
+
+    void initialize() override;
+    void handleMessage(cMessage* msg) override;
+
+    /**
+     * Have app handle msg at time, replacing any pending schedule of msg.
+     */
+    void schedule(DemoBaseApplLayer* app, cMessage* msg, simtime_t time);
+
+    /**
+     * Do not let msg fire (if it was scheduled).
+     */
+    void cancel(cMessage* msg);
+
+    /**
+     * Whether msg of app is scheduled to fire.
+     *
+     * Messages are identified by address, which a message of a deleted app may share with one of a new app,
+     * so app is compared to the app the message was scheduled for.
+     */
+    bool isPending(const DemoBaseApplLayer* app, cMessage* msg) const;
+
+protected:
+    struct Event {
+        int moduleId;
+        DemoBaseApplLayer* app;
+        cMessage* msg;
+        uint64_t serial;
+    };
+
+    /** @brief arm wakeup for the earliest pending event */
+    void rearm();
+
+    std::unique_ptr<TimingWheel<Event>> wheel;
+
+    struct Pending {
+        int moduleId;
+        uint64_t serial;
+    };
+
+    /** @brief app and serial of the pending schedule of each message; events with another serial were cancelled or replaced */
+    std::unordered_map<const cMessage*, Pending> pending;
+    uint64_t nextSerial;
+
+    /** @brief whether events are being handed to apps (and wakeup will be rearmed afterwards) */
+    bool firing;
+
+    cMessage* wakeup;
+};
+
+} // namespace veins
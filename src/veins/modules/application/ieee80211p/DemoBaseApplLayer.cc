@@ -22,6 +22,8 @@
 
 #include "veins/modules/application/ieee80211p/DemoBaseApplLayer.h"
 
+#include "veins/modules/application/ieee80211p/BeaconScheduler.h"
+
 using namespace veins;
 
 void DemoBaseApplLayer::initialize(int stage)
@@ -70,6 +72,18 @@ void DemoBaseApplLayer::initialize(int stage)
         sendBeaconEvt = new cMessage("beacon evt", SEND_BEACON_EVT);
         sendWSAEvt = new cMessage("wsa evt", SEND_WSA_EVT);
 
+        std::string beaconSchedulerPath = par("beaconSchedulerModule").stdstringValue();
+        if (beaconSchedulerPath != "") {
+            beaconScheduler = dynamic_cast<BeaconScheduler*>(veins::findModuleByPath(beaconSchedulerPath.c_str()));
+            if (!beaconScheduler) throw cRuntimeError("Could not find BeaconScheduler \"%s\"", beaconSchedulerPath.c_str());
+        }
+
+        std::string messagePoolPath = par("messagePoolModule").stdstringValue();
+        if (messagePoolPath != "") {
+            messagePool = dynamic_cast<MessagePool*>(veins::findModuleByPath(messagePoolPath.c_str()));
+            if (!messagePool) throw cRuntimeError("Could not find MessagePool \"%s\"", messagePoolPath.c_str());
+        }
+
         generatedBSMs = 0;
         generatedWSAs = 0;
         generatedWSMs = 0;
@@ -103,7 +117,7 @@ void DemoBaseApplLayer::initialize(int stage)
             }
 
             if (sendBeacons) {
-                scheduleAt(firstBeacon, sendBeaconEvt);
+                schedulePeriodicEvent(firstBeacon, sendBeaconEvt);
             }
         }
     }
@@ -222,24 +236,24 @@ void DemoBaseApplLayer::handleLowerMsg(cMessage* msg)
         onWSM(wsm);
     }
 
-    delete (msg);
+    disposeMessage(msg);
 }
 
 void DemoBaseApplLayer::handleSelfMsg(cMessage* msg)
 {
     switch (msg->getKind()) {
     case SEND_BEACON_EVT: {
-        DemoSafetyMessage* bsm = new DemoSafetyMessage();
+        DemoSafetyMessage* bsm = createMessage<DemoSafetyMessage>();
         populateWSM(bsm);
         sendDown(bsm);
-        scheduleAt(simTime() + beaconInterval, sendBeaconEvt);
+        schedulePeriodicEvent(simTime() + beaconInterval, sendBeaconEvt);
         break;
     }
     case SEND_WSA_EVT: {
-        DemoServiceAdvertisment* wsa = new DemoServiceAdvertisment();
+        DemoServiceAdvertisment* wsa = createMessage<DemoServiceAdvertisment>();
         populateWSM(wsa);
         sendDown(wsa);
-        scheduleAt(simTime() + wsaInterval, sendWSAEvt);
+        schedulePeriodicEvent(simTime() + wsaInterval, sendWSAEvt);
         break;
     }
     default: {
@@ -270,7 +284,7 @@ DemoBaseApplLayer::~DemoBaseApplLayer()
 
 void DemoBaseApplLayer::startService(Channel channel, int serviceId, std::string serviceDescription)
 {
-    if (sendWSAEvt->isScheduled()) {
+    if (isPeriodicEventScheduled(sendWSAEvt)) {
         throw cRuntimeError("Starting service although another service was already started");
     }
 
@@ -280,15 +294,59 @@ void DemoBaseApplLayer::startService(Channel channel, int serviceId, std::string
     currentServiceDescription = serviceDescription;
 
     simtime_t wsaTime = computeAsynchronousSendingTime(wsaInterval, ChannelType::control);
-    scheduleAt(wsaTime, sendWSAEvt);
+    schedulePeriodicEvent(wsaTime, sendWSAEvt);
 }
 
 void DemoBaseApplLayer::stopService()
 {
-    cancelEvent(sendWSAEvt);
+    cancelPeriodicEvent(sendWSAEvt);
     currentOfferedServiceId = -1;
 }
 
+void DemoBaseApplLayer::handlePeriodicEvent(cMessage* msg)
+{
+    Enter_Method_Silent();
+    handleSelfMsg(msg);
+}
+
+void DemoBaseApplLayer::schedulePeriodicEvent(simtime_t time, cMessage* msg)
+{
+    if (beaconScheduler) {
+        beaconScheduler->schedule(this, msg, time);
+    }
+    else {
+        scheduleAt(time, msg);
+    }
+}
+
+void DemoBaseApplLayer::cancelPeriodicEvent(cMessage* msg)
+{
+    if (beaconScheduler) {
+        beaconScheduler->cancel(msg);
+    }
+    else {
+        cancelEvent(msg);
+    }
+}
+
+bool DemoBaseApplLayer::isPeriodicEventScheduled(cMessage* msg) const
+{
+    if (beaconScheduler) {
+        return beaconScheduler->isPending(this, msg);
+    }
+    return msg->isScheduled();
+}
+
+void DemoBaseApplLayer::disposeMessage(cMessage* msg)
+{
+    if (messagePool) {
+        messagePool->release(msg);
+    }
+    else {
+        delete msg;
+    }
+}
+
 void DemoBaseApplLayer::sendDown(cMessage* msg)
 {
     checkAndTrackPacket(msg);
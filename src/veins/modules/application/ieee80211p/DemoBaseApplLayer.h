@@ -25,6 +25,7 @@
 #include <map>
 
 #include "veins/base/modules/BaseApplLayer.h"
+#include "veins/modules/application/ieee80211p/MessagePool.h"
 #include "veins/modules/utility/Consts80211p.h"
 #include "veins/modules/messages/BaseFrame1609_4_m.h"
 #include "veins/modules/messages/DemoServiceAdvertisement_m.h"
@@ -42,6 +43,8 @@ using veins::TraCICommandInterface;
 using veins::TraCIMobility;
 using veins::TraCIMobilityAccess;
 
+class BeaconScheduler;
+
 /**
  * @brief
  * Demo application layer base class.
@@ -64,6 +67,9 @@ public:
 
     void receiveSignal(cComponent* source, simsignal_t signalID, cObject* obj, cObject* details) override;
 
+    /** @brief handle a periodic event that was scheduled with a BeaconScheduler */
+    void handlePeriodicEvent(cMessage* msg);
+
     enum DemoApplMessageKinds {
         SEND_BEACON_EVT,
         SEND_WSA_EVT
@@ -134,6 +140,28 @@ protected:
      */
     virtual void checkAndTrackPacket(cMessage* msg);
 
+    /** @brief schedule a self message for a periodic event, using the BeaconScheduler if there is one */
+    void schedulePeriodicEvent(simtime_t time, cMessage* msg);
+
+    /** @brief cancel a self message scheduled with schedulePeriodicEvent */
+    void cancelPeriodicEvent(cMessage* msg);
+
+    /** @brief whether a self message scheduled with schedulePeriodicEvent is pending */
+    bool isPeriodicEventScheduled(cMessage* msg) const;
+
+    /** @brief create a message of type T, recycling one from the MessagePool if there is one */
+    template <typename T>
+    T* createMessage()
+    {
+        if (!messagePool) return new T();
+        T* msg = messagePool->acquire<T>();
+        if (msg->getOwner() != this) take(msg);
+        return msg;
+    }
+
+    /** @brief delete a message, handing it to the MessagePool if there is one */
+    void disposeMessage(cMessage* msg);
+
 protected:
     /* pointers ill be set when used with TraCIMobility */
     TraCIMobility* mobility;
@@ -180,6 +208,12 @@ protected:
     /* messages for periodic events such as beacon and WSA transmissions */
     cMessage* sendBeaconEvt;
     cMessage* sendWSAEvt;
+
+    /** @brief shared scheduler for the messages above (nullptr if they are scheduled as self messages) */
+    BeaconScheduler* beaconScheduler = nullptr;
+
+    /** @brief pool to recycle sent and received messages with (nullptr to allocate them as usual) */
+    MessagePool* messagePool = nullptr;
 };
 
 } // namespace veins
@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/application/ieee80211p/MessagePool.h"
+
+using namespace veins;
+
+Define_Module(veins::MessagePool);
+
+MessagePool::~MessagePool()
+{
+    for (auto& entry : pools) {
+        for (auto msg : entry.second.messages) {
+            delete msg;
+        }
+    }
+}
+
+void MessagePool::initialize()
+{
+    int capacityPar = par("capacity");
+    if (capacityPar < 0) throw cRuntimeError("capacity must not be negative");
+    capacity = capacityPar;
+}
+
+void MessagePool::finish()
+{
+    for (auto& entry : pools) {
+        const Pool& pool = entry.second;
+        recordScalar((pool.className + " poolHits").c_str(), pool.hits);
+        recordScalar((pool.className + " poolMisses").c_str(), pool.misses);
+        recordScalar((pool.className + " poolDiscarded").c_str(), pool.discarded);
+        if (pool.hits + pool.misses > 0) {
+            recordScalar((pool.className + " poolHitRate").c_str(), double(pool.hits) / (pool.hits + pool.misses));
+        }
+    }
+}
+
+MessagePool::Pool& MessagePool::getPool(const std::type_info& type, void (*reset)(cMessage*))
+{
+    auto it = pools.find(type);
+    if (it == pools.end()) {
+        it = pools.emplace(type, Pool()).first;
+        it->second.className = opp_typename(type);
+        it->second.messages.reserve(capacity);
+        it->second.reset = reset;
+    }
+    return it->second;
+}
+
+void MessagePool::release(cMessage* msg)
+{
+    Enter_Method_Silent();
+
+    auto it = pools.find(typeid(*msg));
+    if (it == pools.end() || it->second.messages.size() >= capacity) {
+        if (it != pools.end()) it->second.discarded++;
+        delete msg;
+        return;
+    }
+
+    // destroying the message drops its control info and encapsulated packets, the new one is owned by the context (i.e., this module)
+    it->second.reset(msg);
+    it->second.messages.push_back(msg);
+}
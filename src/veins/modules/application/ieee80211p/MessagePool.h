@@ -0,0 +1,106 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <map>
+#include <new>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * Recycles application messages (e.g., DemoSafetyMessage, DemoServiceAdvertisment, BaseFrame1609_4) instead of allocating a fresh one per transmission.
+ *
+ * Receivers release() messages they are done with; senders acquire() them again.
+ * On release, a message is destroyed and constructed anew in the same memory, so it gets fresh ids and default field values without a trip through the allocator.
+ * Pooled messages are owned by this module, so they outlive the module that released them.
+ * Each message type is pooled separately, up to capacity messages; messages of types nobody acquires from the pool are deleted on release.
+ *
+ * DemoBaseApplLayer modules whose messagePoolModule parameter points to this module use it for their beacons and service advertisements.
+ * Whether this is any faster than plain new and delete depends on the allocator; hits and misses of each pool are recorded so this can be judged per scenario.
+ */
+class VEINS_API MessagePool : public cSimpleModule {
+public:
+    ~MessagePool() override;
+
+    void initialize() override;
+    void finish() override;
+
+    /**
+     * Return a message of type T in the state of a newly constructed one.
+     *
+     * A recycled message is still owned by this module: callers must take() it (see DemoBaseApplLayer::createMessage).
+     * Its creation time is the time it was released.
+     */
+    template <typename T>
+    T* acquire()
+    {
+        Pool& pool = getPool(typeid(T), &reconstruct<T>);
+        if (pool.messages.empty()) {
+            pool.misses++;
+            return new T();
+        }
+        pool.hits++;
+        T* msg = static_cast<T*>(pool.messages.back());
+        pool.messages.pop_back();
+        return msg;
+    }
+
+    /**
+     * Hand msg over for reuse (or deletion, if its pool is full or its type is not pooled).
+     */
+    void release(cMessage* msg);
+
+protected:
+    struct Pool {
+        std::string className;
+        std::vector<cMessage*> messages;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t discarded = 0;
+        void (*reset)(cMessage*) = nullptr; /**< destroys a message of this type and constructs a new one in its place */
+    };
+
+    /**
+     * Destroy msg (of exact type T) and construct a new T in its place, owned by the current context.
+     */
+    template <typename T>
+    static void reconstruct(cMessage* msg)
+    {
+        T* typed = static_cast<T*>(msg);
+        typed->~T();
+        ::new (static_cast<void*>(typed)) T();
+    }
+
+    Pool& getPool(const std::type_info& type, void (*reset)(cMessage*));
+
+    size_t capacity = 0;
+    std::map<std::type_index, Pool> pools;
+};
+
+} // namespace veins
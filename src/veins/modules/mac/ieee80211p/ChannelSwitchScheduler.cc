@@ -0,0 +1,110 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/mac/ieee80211p/ChannelSwitchScheduler.h"
+
+#include "veins/modules/mac/ieee80211p/Mac1609_4.h"
+#include "veins/modules/utility/Consts80211p.h"
+
+using namespace veins;
+
+Define_Module(veins::ChannelSwitchScheduler);
+
+ChannelSwitchScheduler::ChannelSwitchScheduler()
+    : scheduledOffset(0)
+    , switchEvent(new cMessage("Channel Switch"))
+{
+}
+
+ChannelSwitchScheduler::~ChannelSwitchScheduler()
+{
+    cancelAndDelete(switchEvent);
+}
+
+simtime_t ChannelSwitchScheduler::subscribe(Mac1609_4* mac, simtime_t firstSwitch)
+{
+    Enter_Method_Silent();
+    ASSERT(firstSwitch > simTime());
+
+    int64_t offset = firstSwitch.raw() % SWITCHING_INTERVAL_11P.raw();
+
+    // share offsets between MACs, so they are switched in one event
+    int64_t offsetResolution = simtime_t(par("offsetResolution").doubleValue()).raw();
+    if (offsetResolution > 0) {
+        int64_t rounding = offset % offsetResolution;
+        offset -= rounding;
+        firstSwitch -= SimTime().setRaw(rounding);
+        ASSERT(firstSwitch > simTime());
+    }
+
+    groups[offset].push_back({mac->getId(), mac, firstSwitch});
+
+    if (switchEvent->isScheduled()) {
+        if (switchEvent->getArrivalTime() <= firstSwitch) return firstSwitch;
+        cancelEvent(switchEvent);
+    }
+    scheduledOffset = offset;
+    scheduleAt(firstSwitch, switchEvent);
+    return firstSwitch;
+}
+
+void ChannelSwitchScheduler::handleMessage(cMessage* msg)
+{
+    ASSERT(msg == switchEvent);
+    simtime_t now = simTime();
+
+    auto group = groups.find(scheduledOffset);
+    ASSERT(group != groups.end());
+    auto& subscribers = group->second;
+    for (size_t i = 0; i < subscribers.size();) {
+        Subscriber& subscriber = subscribers[i];
+        if (getSimulation()->getModule(subscriber.moduleId) != static_cast<cModule*>(subscriber.mac)) {
+            // the MAC was deleted
+            subscribers[i] = subscribers.back();
+            subscribers.pop_back();
+            continue;
+        }
+        // subscribers that joined after the group was scheduled may only be due in the next interval
+        if (subscriber.nextSwitch == now) {
+            subscriber.nextSwitch += SWITCHING_INTERVAL_11P;
+            subscriber.mac->handleChannelSwitch();
+        }
+        ++i;
+    }
+    if (subscribers.empty()) {
+        groups.erase(group);
+    }
+    if (groups.empty()) return;
+
+    // visit groups in order of their offset, wrapping around into the next switching interval
+    auto next = groups.upper_bound(scheduledOffset);
+    simtime_t nextTime;
+    if (next != groups.end()) {
+        nextTime = now + SimTime().setRaw(next->first - scheduledOffset);
+    }
+    else {
+        next = groups.begin();
+        nextTime = now + SWITCHING_INTERVAL_11P - SimTime().setRaw(scheduledOffset - next->first);
+    }
+    scheduledOffset = next->first;
+    scheduleAt(nextTime, switchEvent);
+}
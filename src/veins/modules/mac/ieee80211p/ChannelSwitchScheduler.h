@@ -0,0 +1,79 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+class Mac1609_4;
+
+/**
+ * Performs the periodic CCH/SCH switches of all Mac1609_4 modules in the network with a single self-message.
+ *
+ * Each MAC switches channels every SWITCHING_INTERVAL_11P, shifted by its own sync offset.
+ * MACs that share the same offset are switched in one event, so the event queue only ever holds one entry for channel switching.
+ * Note that MACs draw their sync offsets at random (up to the syncOffset parameter of Mac1609_4, 0.3 ms by default),
+ * so unless offsets are rounded to a coarser offsetResolution, every MAC still gets an event of its own per switching interval;
+ * only the number of pending events shrinks.
+ * An offsetResolution of at least syncOffset lets all MACs share one offset and switch in one event.
+ *
+ * Mac1609_4 modules whose channelSwitchSchedulerModule parameter points to this module subscribe to it
+ * instead of scheduling their own switches. Switching times are the same either way, unless offsetResolution is set.
+ */
+class VEINS_API ChannelSwitchScheduler : public cSimpleModule {
+public:
+    ChannelSwitchScheduler();
+    ~ChannelSwitchScheduler() override;
+
+    void handleMessage(cMessage* msg) override;
+
+    /**
+     * Let mac switch channels at firstSwitch (with its offset into the switching interval rounded down to offsetResolution) and every SWITCHING_INTERVAL_11P thereafter.
+     *
+     * MACs need not unsubscribe; deleted modules are dropped on their next switch.
+     *
+     * @return the time of the first switch
+     */
+    simtime_t subscribe(Mac1609_4* mac, simtime_t firstSwitch);
+
+protected:
+    struct Subscriber {
+        int moduleId;
+        Mac1609_4* mac;
+        simtime_t nextSwitch;
+    };
+
+    /** @brief subscribers, grouped by the raw offset of their switches into the switching interval */
+    std::map<int64_t, std::vector<Subscriber>> groups;
+
+    /** @brief offset of the group that switchEvent fires for */
+    int64_t scheduledOffset;
+
+    cMessage* switchEvent;
+};
+
+} // namespace veins
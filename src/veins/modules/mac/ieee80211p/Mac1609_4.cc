@@ -24,6 +24,8 @@
 #include "veins/modules/mac/ieee80211p/Mac1609_4.h"
 #include <iterator>
 
+#include "veins/modules/mac/ieee80211p/ChannelSwitchScheduler.h"
+
 #include "veins/modules/phy/DeciderResult80211.h"
 #include "veins/base/phyLayer/PhyToMacControlInfo.h"
 #include "veins/modules/messages/PhyControlMessage_m.h"
@@ -41,6 +43,8 @@ const simsignal_t Mac1609_4::sigSentPacket = registerSignal("org_car2x_veins_mod
 const simsignal_t Mac1609_4::sigSentAck = registerSignal("org_car2x_veins_modules_mac_sigSentAck");
 const simsignal_t Mac1609_4::sigRetriesExceeded = registerSignal("org_car2x_veins_modules_mac_sigRetriesExceeded");
 
+constexpr size_t Mac1609_4::numAccessCategories;
+
 void Mac1609_4::initialize(int stage)
 {
     BaseMacLayer::initialize(stage);
@@ -64,29 +68,34 @@ void Mac1609_4::initialize(int stage)
         useAcks = par("useAcks").boolValue();
         frameErrorRate = par("frameErrorRate").doubleValue();
         ackErrorRate = par("ackErrorRate").doubleValue();
+        int duplicateDetectionCacheSize = par("duplicateDetectionCacheSize");
+        if (duplicateDetectionCacheSize < 0) throw cRuntimeError("duplicateDetectionCacheSize must not be negative");
+        handledUnicastToApp.setCapacity(duplicateDetectionCacheSize);
         rxStartIndication = false;
         ignoreChannelState = false;
         waitUntilAckRXorTimeout = false;
+        lastWaitsForAck = false;
+        lastMacWasAck = false;
         stopIgnoreChannelStateMsg = new cMessage("ChannelStateMsg");
 
         myId = getParentModule()->getParentModule()->getFullPath();
         // create two edca systems
 
-        myEDCA[ChannelType::control] = make_unique<EDCA>(this, ChannelType::control, par("queueSize"));
-        myEDCA[ChannelType::control]->myId = myId;
-        myEDCA[ChannelType::control]->myId.append(" CCH");
-        myEDCA[ChannelType::control]->createQueue(2, (((CWMIN_11P + 1) / 4) - 1), (((CWMIN_11P + 1) / 2) - 1), AC_VO);
-        myEDCA[ChannelType::control]->createQueue(3, (((CWMIN_11P + 1) / 2) - 1), CWMIN_11P, AC_VI);
-        myEDCA[ChannelType::control]->createQueue(6, CWMIN_11P, CWMAX_11P, AC_BE);
-        myEDCA[ChannelType::control]->createQueue(9, CWMIN_11P, CWMAX_11P, AC_BK);
-
-        myEDCA[ChannelType::service] = make_unique<EDCA>(this, ChannelType::service, par("queueSize"));
-        myEDCA[ChannelType::service]->myId = myId;
-        myEDCA[ChannelType::service]->myId.append(" SCH");
-        myEDCA[ChannelType::service]->createQueue(2, (((CWMIN_11P + 1) / 4) - 1), (((CWMIN_11P + 1) / 2) - 1), AC_VO);
-        myEDCA[ChannelType::service]->createQueue(3, (((CWMIN_11P + 1) / 2) - 1), CWMIN_11P, AC_VI);
-        myEDCA[ChannelType::service]->createQueue(6, CWMIN_11P, CWMAX_11P, AC_BE);
-        myEDCA[ChannelType::service]->createQueue(9, CWMIN_11P, CWMAX_11P, AC_BK);
+        myEDCA[static_cast<size_t>(ChannelType::control)] = make_unique<EDCA>(this, ChannelType::control, par("queueSize"));
+        getEDCA(ChannelType::control).myId = myId;
+        getEDCA(ChannelType::control).myId.append(" CCH");
+        getEDCA(ChannelType::control).createQueue(2, (((CWMIN_11P + 1) / 4) - 1), (((CWMIN_11P + 1) / 2) - 1), AC_VO);
+        getEDCA(ChannelType::control).createQueue(3, (((CWMIN_11P + 1) / 2) - 1), CWMIN_11P, AC_VI);
+        getEDCA(ChannelType::control).createQueue(6, CWMIN_11P, CWMAX_11P, AC_BE);
+        getEDCA(ChannelType::control).createQueue(9, CWMIN_11P, CWMAX_11P, AC_BK);
+
+        myEDCA[static_cast<size_t>(ChannelType::service)] = make_unique<EDCA>(this, ChannelType::service, par("queueSize"));
+        getEDCA(ChannelType::service).myId = myId;
+        getEDCA(ChannelType::service).myId.append(" SCH");
+        getEDCA(ChannelType::service).createQueue(2, (((CWMIN_11P + 1) / 4) - 1), (((CWMIN_11P + 1) / 2) - 1), AC_VO);
+        getEDCA(ChannelType::service).createQueue(3, (((CWMIN_11P + 1) / 2) - 1), CWMIN_11P, AC_VI);
+        getEDCA(ChannelType::service).createQueue(6, CWMIN_11P, CWMAX_11P, AC_BE);
+        getEDCA(ChannelType::service).createQueue(9, CWMIN_11P, CWMAX_11P, AC_BK);
 
         useSCH = par("useServiceChannel").boolValue();
         if (useSCH) {
@@ -115,6 +124,7 @@ void Mac1609_4::initialize(int stage)
         headerLength = par("headerLength");
 
         nextMacEvent = new cMessage("next Mac Event");
+        nextMacEventTime = -1;
 
         if (useSCH) {
             uint64_t currenTime = simTime().raw();
@@ -128,10 +138,20 @@ void Mac1609_4::initialize(int stage)
             }
 
             // channel switching active
-            nextChannelSwitch = new cMessage("Channel Switch");
             // add a little bit of offset between all vehicles, but no more than syncOffset
             simtime_t offset = dblrand() * par("syncOffset").doubleValue();
-            scheduleAt(simTime() + offset + timeToNextSwitch, nextChannelSwitch);
+            lastChannelSwitchTime = simTime();
+            nextChannelSwitchTime = simTime() + offset + timeToNextSwitch;
+            std::string schedulerPath = par("channelSwitchSchedulerModule").stdstringValue();
+            if (schedulerPath != "") {
+                auto channelSwitchScheduler = dynamic_cast<ChannelSwitchScheduler*>(veins::findModuleByPath(schedulerPath.c_str()));
+                if (!channelSwitchScheduler) throw cRuntimeError("Could not find ChannelSwitchScheduler \"%s\"", schedulerPath.c_str());
+                nextChannelSwitchTime = channelSwitchScheduler->subscribe(this, nextChannelSwitchTime);
+            }
+            else {
+                nextChannelSwitch = new cMessage("Channel Switch");
+                scheduleAt(nextChannelSwitchTime, nextChannelSwitch);
+            }
         }
         else {
             // no channel switching
@@ -173,37 +193,29 @@ void Mac1609_4::handleSelfMsg(cMessage* msg)
     }
 
     if (msg == nextChannelSwitch) {
-        ASSERT(useSCH);
-
         scheduleAt(simTime() + SWITCHING_INTERVAL_11P, nextChannelSwitch);
-
-        switch (activeChannel) {
-        case ChannelType::control:
-            EV_TRACE << "CCH --> SCH" << std::endl;
-            channelBusySelf(false);
-            setActiveChannel(ChannelType::service);
-            channelIdle(true);
-            phy11p->changeListeningChannel(mySCH);
-            break;
-        case ChannelType::service:
-            EV_TRACE << "SCH --> CCH" << std::endl;
-            channelBusySelf(false);
-            setActiveChannel(ChannelType::control);
-            channelIdle(true);
-            phy11p->changeListeningChannel(Channel::cch);
-            break;
-        }
-        // schedule next channel switch in 50ms
+        handleChannelSwitch();
     }
     else if (msg == nextMacEvent) {
 
+        if (nextMacEventTime == -1) {
+            // contention was stopped after this timer was armed
+            return;
+        }
+        if (simTime() < nextMacEventTime) {
+            // contention was restarted with a later deadline after this timer was armed
+            scheduleAt(nextMacEventTime, nextMacEvent);
+            return;
+        }
+        nextMacEventTime = -1;
+
         // we actually came to the point where we can send a packet
         channelBusySelf(true);
-        BaseFrame1609_4* pktToSend = myEDCA[activeChannel]->initiateTransmit(lastIdle);
+        BaseFrame1609_4* pktToSend = getEDCA(activeChannel).initiateTransmit(lastIdle);
         ASSERT(pktToSend);
 
         lastAC = mapUserPriority(pktToSend->getUserPriority());
-        lastWSM = pktToSend;
+        bool waitForAck = pktToSend->getRecipientAddress() != LAddress::L2BROADCAST() && useAcks;
 
         EV_TRACE << "MacEvent received. Trying to send packet with priority" << lastAC << std::endl;
 
@@ -216,7 +228,6 @@ void Mac1609_4::handleSelfMsg(cMessage* msg)
             mac->setDestAddr(LAddress::L2BROADCAST());
         }
         mac->setSrcAddr(myMacAddr);
-        mac->encapsulate(pktToSend->dup());
 
         MCS usedMcs = mcs;
         double txPower_mW;
@@ -237,7 +248,8 @@ void Mac1609_4::handleSelfMsg(cMessage* msg)
             txPower_mW = txPower;
         }
 
-        simtime_t sendingDuration = RADIODELAY_11P + phy11p->getFrameDuration(mac->getBitLength(), usedMcs);
+        // the frame is only encapsulated once we know that it goes on air
+        simtime_t sendingDuration = RADIODELAY_11P + phy11p->getFrameDuration(mac->getBitLength() + pktToSend->getBitLength(), usedMcs);
         EV_TRACE << "Sending duration will be" << sendingDuration << std::endl;
         if ((!useSCH) || (timeLeftInSlot() > sendingDuration)) {
             if (useSCH) EV_TRACE << " Time in this slot left: " << timeLeftInSlot() << std::endl;
@@ -245,26 +257,41 @@ void Mac1609_4::handleSelfMsg(cMessage* msg)
             Channel channelNr = (activeChannel == ChannelType::control) ? Channel::cch : mySCH;
             double freq = IEEE80211ChannelFrequencies.at(channelNr);
 
+            lastWaitsForAck = waitForAck;
+            if (waitForAck) {
+                // the queue keeps the frame for retransmissions
+                mac->encapsulate(pktToSend->dup());
+            }
+            else {
+                // the frame will never be retransmitted, so hand it over instead of a copy.
+                // its queue slot stays occupied until postTransmit, so queue lengths do not change while it is on air
+                ASSERT(getEDCA(activeChannel).myQueues[lastAC].queue.front() == pktToSend);
+                delete pktToSend->removeControlInfo();
+                getEDCA(activeChannel).myQueues[lastAC].queue.front() = nullptr;
+                mac->encapsulate(pktToSend);
+                pktToSend = nullptr;
+            }
+
             EV_TRACE << "Sending a Packet. Frequency " << freq << " Priority" << lastAC << std::endl;
             sendFrame(mac, RADIODELAY_11P, channelNr, usedMcs, txPower_mW);
 
             // schedule ack timeout for unicast packets
-            if (pktToSend->getRecipientAddress() != LAddress::L2BROADCAST() && useAcks) {
+            if (waitForAck) {
                 waitUntilAckRXorTimeout = true;
                 // PHY-RXSTART.indication should be received within ackWaitTime
                 // sifs + slot + rx_delay: see 802.11-2012 9.3.2.8 (32us + 13us + 49us = 94us)
                 simtime_t ackWaitTime(94, SIMTIME_US);
                 // update id in the retransmit timer
-                myEDCA[activeChannel]->myQueues[lastAC].ackTimeOut->setWsmId(pktToSend->getTreeId());
+                getEDCA(activeChannel).myQueues[lastAC].ackTimeOut->setWsmId(pktToSend->getTreeId());
                 simtime_t timeOut = sendingDuration + ackWaitTime;
-                scheduleAt(simTime() + timeOut, myEDCA[activeChannel]->myQueues[lastAC].ackTimeOut);
+                scheduleAt(simTime() + timeOut, getEDCA(activeChannel).myQueues[lastAC].ackTimeOut);
             }
         }
         else { // not enough time left now
             EV_TRACE << "Too little Time left. This packet cannot be send in this slot." << std::endl;
             statsNumTooLittleTime++;
             // revoke TXOP
-            myEDCA[activeChannel]->revokeTxOPs();
+            getEDCA(activeChannel).revokeTxOPs();
             delete mac;
             channelIdle();
             // do nothing. contention will automatically start after channel switch
@@ -272,6 +299,32 @@ void Mac1609_4::handleSelfMsg(cMessage* msg)
     }
 }
 
+void Mac1609_4::handleChannelSwitch()
+{
+    Enter_Method_Silent();
+    ASSERT(useSCH);
+
+    lastChannelSwitchTime = simTime();
+    nextChannelSwitchTime = simTime() + SWITCHING_INTERVAL_11P;
+
+    switch (activeChannel) {
+    case ChannelType::control:
+        EV_TRACE << "CCH --> SCH" << std::endl;
+        channelBusySelf(false);
+        setActiveChannel(ChannelType::service);
+        channelIdle(true);
+        phy11p->changeListeningChannel(mySCH);
+        break;
+    case ChannelType::service:
+        EV_TRACE << "SCH --> CCH" << std::endl;
+        channelBusySelf(false);
+        setActiveChannel(ChannelType::control);
+        channelIdle(true);
+        phy11p->changeListeningChannel(Channel::cch);
+        break;
+    }
+}
+
 void Mac1609_4::handleUpperControl(cMessage* msg)
 {
     ASSERT(false);
@@ -297,7 +350,7 @@ void Mac1609_4::handleUpperMsg(cMessage* msg)
         chan = ChannelType::service;
     }
 
-    int num = myEDCA[chan]->queuePacket(ac, thisMsg);
+    int num = getEDCA(chan).queuePacket(ac, thisMsg);
 
     // packet was dropped in Mac
     if (num == -1) {
@@ -317,29 +370,26 @@ void Mac1609_4::handleUpperMsg(cMessage* msg)
 
     if (num == 1 && idleChannel == true && chan == activeChannel) {
 
-        simtime_t nextEvent = myEDCA[chan]->startContent(lastIdle, guardActive());
+        simtime_t nextEvent = getEDCA(chan).startContent(lastIdle, guardActive());
 
         if (nextEvent != -1) {
-            if ((!useSCH) || (nextEvent <= nextChannelSwitch->getArrivalTime())) {
-                if (nextMacEvent->isScheduled()) {
-                    cancelEvent(nextMacEvent);
-                }
-                scheduleAt(nextEvent, nextMacEvent);
-                EV_TRACE << "Updated nextMacEvent:" << nextMacEvent->getArrivalTime().raw() << std::endl;
+            if ((!useSCH) || (nextEvent <= nextChannelSwitchTime)) {
+                scheduleNextMacEvent(nextEvent);
+                EV_TRACE << "Updated nextMacEvent:" << nextEvent.raw() << std::endl;
             }
             else {
                 EV_TRACE << "Too little time in this interval. Will not schedule nextMacEvent" << std::endl;
                 // it is possible that this queue has an txop. we have to revoke it
-                myEDCA[activeChannel]->revokeTxOPs();
+                getEDCA(activeChannel).revokeTxOPs();
                 statsNumTooLittleTime++;
             }
         }
         else {
-            cancelEvent(nextMacEvent);
+            cancelNextMacEvent();
         }
     }
-    if (num == 1 && idleChannel == false && myEDCA[chan]->myQueues[ac].currentBackoff == 0 && chan == activeChannel) {
-        myEDCA[chan]->backoff(ac);
+    if (num == 1 && idleChannel == false && getEDCA(chan).myQueues[ac].currentBackoff == 0 && chan == activeChannel) {
+        getEDCA(chan).backoff(ac);
     }
 }
 
@@ -363,10 +413,10 @@ void Mac1609_4::handleLowerControl(cMessage* msg)
 
         phy->setRadioState(Radio::RX);
 
-        if (!dynamic_cast<Mac80211Ack*>(lastMac.get())) {
+        if (!lastMacWasAck) {
             // message was sent
             // update EDCA queue. go into post-transmit backoff and set cwCur to cwMin
-            myEDCA[activeChannel]->postTransmit(lastAC, lastWSM, useAcks);
+            getEDCA(activeChannel).postTransmit(lastAC, lastWaitsForAck);
         }
         // channel just turned idle.
         // don't set the chan to idle. the PHY layer decides, not us.
@@ -425,10 +475,10 @@ void Mac1609_4::setActiveChannel(ChannelType state)
 
 void Mac1609_4::finish()
 {
-    for (auto&& p : myEDCA) {
-        statsNumInternalContention += p.second->statsNumInternalContention;
-        statsNumBackoff += p.second->statsNumBackoff;
-        statsSlotsBackoff += p.second->statsSlotsBackoff;
+    for (auto&& edca : myEDCA) {
+        statsNumInternalContention += edca->statsNumInternalContention;
+        statsNumBackoff += edca->statsNumBackoff;
+        statsSlotsBackoff += edca->statsSlotsBackoff;
     }
 
     recordScalar("ReceivedUnicastPackets", statsReceivedPackets);
@@ -474,10 +524,10 @@ void Mac1609_4::sendFrame(Mac80211Pkt* frame, simtime_t delay, Channel channelNr
     attachControlInfo(frame, channelNr, mcs, txPower_mW);
     check_and_cast<MacToPhyControlInfo11p*>(frame->getControlInfo());
 
-    lastMac.reset(frame->dup());
+    lastMacWasAck = dynamic_cast<Mac80211Ack*>(frame) != nullptr;
     sendDelayed(frame, delay, lowerLayerOut);
 
-    if (dynamic_cast<Mac80211Ack*>(frame)) {
+    if (lastMacWasAck) {
         statsSentAcks += 1;
         emit(sigSentAck, true);
     }
@@ -487,6 +537,23 @@ void Mac1609_4::sendFrame(Mac80211Pkt* frame, simtime_t delay, Channel channelNr
     }
 }
 
+void Mac1609_4::scheduleNextMacEvent(simtime_t time)
+{
+    nextMacEventTime = time;
+    if (nextMacEvent->isScheduled()) {
+        // a timer that fires no later than the new deadline is re-armed when it fires
+        if (nextMacEvent->getArrivalTime() <= time) return;
+        cancelEvent(nextMacEvent);
+    }
+    scheduleAt(time, nextMacEvent);
+}
+
+void Mac1609_4::cancelNextMacEvent()
+{
+    // the timer stays armed and is ignored when it fires
+    nextMacEventTime = -1;
+}
+
 void Mac1609_4::attachControlInfo(Mac80211Pkt* mac, Channel channelNr, MCS mcs, double txPower_mW)
 {
     auto cinfo = new MacToPhyControlInfo11p(channelNr, mcs, txPower_mW);
@@ -497,7 +564,7 @@ void Mac1609_4::attachControlInfo(Mac80211Pkt* mac, Channel channelNr, MCS mcs,
 bool Mac1609_4::guardActive() const
 {
     if (!useSCH) return false;
-    if (simTime().dbl() - nextChannelSwitch->getSendingTime() <= GUARD_INTERVAL_11P) return true;
+    if (simTime().dbl() - lastChannelSwitchTime <= GUARD_INTERVAL_11P) return true;
     return false;
 }
 
@@ -506,8 +573,8 @@ simtime_t Mac1609_4::timeLeftTillGuardOver() const
 {
     ASSERT(useSCH);
     simtime_t sTime = simTime();
-    if (sTime - nextChannelSwitch->getSendingTime() <= GUARD_INTERVAL_11P) {
-        return GUARD_INTERVAL_11P - (sTime - nextChannelSwitch->getSendingTime());
+    if (sTime - lastChannelSwitchTime <= GUARD_INTERVAL_11P) {
+        return GUARD_INTERVAL_11P - (sTime - lastChannelSwitchTime);
     }
     else
         return 0;
@@ -517,7 +584,7 @@ simtime_t Mac1609_4::timeLeftTillGuardOver() const
 simtime_t Mac1609_4::timeLeftInSlot() const
 {
     ASSERT(useSCH);
-    return nextChannelSwitch->getArrivalTime() - simTime();
+    return nextChannelSwitchTime - simTime();
 }
 
 /* Will change the Service Channel on which the mac layer is listening and sending */
@@ -637,12 +704,12 @@ int Mac1609_4::EDCA::queuePacket(t_access_category ac, BaseFrame1609_4* msg)
 void Mac1609_4::EDCA::createQueue(int aifsn, int cwMin, int cwMax, t_access_category ac)
 {
 
-    if (myQueues.find(ac) != myQueues.end()) {
+    if (myQueues[ac].ackTimeOut) {
         throw cRuntimeError("You can only add one queue per Access Category per EDCA subsystem");
     }
 
-    EDCAQueue newQueue(aifsn, cwMin, cwMax, ac);
-    myQueues[ac] = newQueue;
+    myQueues[ac] = EDCAQueue(aifsn, cwMin, cwMax, ac);
+    if (maxQueueSize) myQueues[ac].queue.reserve(maxQueueSize);
 }
 
 Mac1609_4::t_access_category Mac1609_4::mapUserPriority(int prio)
@@ -685,24 +752,25 @@ BaseFrame1609_4* Mac1609_4::EDCA::initiateTransmit(simtime_t lastIdle)
     // As t_access_category is sorted by priority, we iterate back to front.
     // This realizes the behavior documented in IEEE Std 802.11-2012 Section 9.2.4.2; that is, "data frames from the higher priority AC" win an internal collision.
     // The phrase "EDCAF of higher UP" of IEEE Std 802.11-2012 Section 9.19.2.3 is assumed to be meaningless.
-    for (auto iter = myQueues.rbegin(); iter != myQueues.rend(); iter++) {
-        if (iter->second.queue.size() != 0 && !iter->second.waitForAck) {
-            if (idleTime >= iter->second.aifsn * SLOTLENGTH_11P + SIFS_11P && iter->second.txOP == true) {
+    for (int accessCategory = AC_VO; accessCategory >= AC_BK; accessCategory--) {
+        auto& edcaQueue = myQueues[accessCategory];
+        if (edcaQueue.queue.size() != 0 && !edcaQueue.waitForAck) {
+            if (idleTime >= edcaQueue.aifsn * SLOTLENGTH_11P + SIFS_11P && edcaQueue.txOP == true) {
 
-                EV_TRACE << "Queue " << iter->first << " is ready to send!" << std::endl;
+                EV_TRACE << "Queue " << accessCategory << " is ready to send!" << std::endl;
 
-                iter->second.txOP = false;
+                edcaQueue.txOP = false;
                 // this queue is ready to send
                 if (pktToSend == nullptr) {
-                    pktToSend = iter->second.queue.front();
+                    pktToSend = edcaQueue.queue.front();
                 }
                 else {
                     // there was already another packet ready. we have to go increase cw and go into backoff. It's called internal contention and its wonderful
 
                     statsNumInternalContention++;
-                    iter->second.cwCur = std::min(iter->second.cwMax, (iter->second.cwCur + 1) * 2 - 1);
-                    iter->second.currentBackoff = owner->intuniform(0, iter->second.cwCur);
-                    EV_TRACE << "Internal contention for queue " << iter->first << " : " << iter->second.currentBackoff << ". Increase cwCur to " << iter->second.cwCur << std::endl;
+                    edcaQueue.cwCur = std::min(edcaQueue.cwMax, (edcaQueue.cwCur + 1) * 2 - 1);
+                    edcaQueue.currentBackoff = owner->intuniform(0, edcaQueue.cwCur);
+                    EV_TRACE << "Internal contention for queue " << accessCategory << " : " << edcaQueue.currentBackoff << ". Increase cwCur to " << edcaQueue.cwCur << std::endl;
                 }
             }
         }
@@ -730,9 +798,8 @@ simtime_t Mac1609_4::EDCA::startContent(simtime_t idleSince, bool guardActive)
 
     // this returns the nearest possible event in this EDCA subsystem after a busy channel
 
-    for (auto&& p : myQueues) {
-        auto& accessCategory = p.first;
-        auto& edcaQueue = p.second;
+    for (size_t accessCategory = 0; accessCategory < numAccessCategories; accessCategory++) {
+        auto& edcaQueue = myQueues[accessCategory];
         if (edcaQueue.queue.size() != 0 && !edcaQueue.waitForAck) {
 
             /* 1609_4 says that when attempting to send (backoff == 0) when guard is active, a random backoff is invoked */
@@ -779,9 +846,8 @@ void Mac1609_4::EDCA::stopContent(bool allowBackoff, bool generateTxOp)
 
     lastStart = -1; // indicate that there was no last start
 
-    for (auto&& p : myQueues) {
-        auto& accessCategory = p.first;
-        auto& edcaQueue = p.second;
+    for (size_t accessCategory = 0; accessCategory < numAccessCategories; accessCategory++) {
+        auto& edcaQueue = myQueues[accessCategory];
         if ((edcaQueue.currentBackoff != 0 || edcaQueue.queue.size() != 0) && !edcaQueue.waitForAck) {
             // check how many slots we already waited until the chan became busy
 
@@ -831,14 +897,13 @@ void Mac1609_4::EDCA::backoff(t_access_category ac)
     EV_TRACE << "Going into Backoff because channel was busy when new packet arrived from upperLayer" << std::endl;
 }
 
-void Mac1609_4::EDCA::postTransmit(t_access_category ac, BaseFrame1609_4* wsm, bool useAcks)
+void Mac1609_4::EDCA::postTransmit(t_access_category ac, bool waitForAck)
 {
-    bool holBlocking = (wsm->getRecipientAddress() != LAddress::L2BROADCAST()) && useAcks;
-    if (holBlocking) {
+    if (waitForAck) {
         // mac->waitUntilAckRXorTimeout = true; // set in handleselfmsg()
         // Head of line blocking, wait until ack timeout
         myQueues[ac].waitForAck = true;
-        myQueues[ac].waitOnUnicastID = wsm->getTreeId();
+        myQueues[ac].waitOnUnicastID = myQueues[ac].queue.front()->getTreeId();
         ((Mac1609_4*) owner)->phy11p->notifyMacAboutRxStart(true);
     }
     else {
@@ -868,7 +933,7 @@ Mac1609_4::EDCA::EDCA(cSimpleModule* owner, ChannelType channelType, int maxQueu
 Mac1609_4::EDCA::~EDCA()
 {
     for (auto& q : myQueues) {
-        auto& ackTimeout = q.second.ackTimeOut;
+        auto& ackTimeout = q.ackTimeOut;
         if (ackTimeout) {
             owner->cancelAndDelete(ackTimeout);
             ackTimeout = nullptr;
@@ -878,8 +943,7 @@ Mac1609_4::EDCA::~EDCA()
 
 void Mac1609_4::EDCA::revokeTxOPs()
 {
-    for (auto&& p : myQueues) {
-        auto& edcaQueue = p.second;
+    for (auto&& edcaQueue : myQueues) {
         if (edcaQueue.txOP == true) {
             edcaQueue.txOP = false;
             edcaQueue.currentBackoff = 0;
@@ -900,13 +964,8 @@ void Mac1609_4::channelBusySelf(bool generateTxOp)
     lastBusy = simTime();
 
     // channel turned busy
-    if (nextMacEvent->isScheduled() == true) {
-        cancelEvent(nextMacEvent);
-    }
-    else {
-        // the edca subsystem was not doing anything anyway.
-    }
-    myEDCA[activeChannel]->stopContent(false, generateTxOp);
+    cancelNextMacEvent();
+    getEDCA(activeChannel).stopContent(false, generateTxOp);
 
     emit(sigChannelBusy, true);
 }
@@ -922,13 +981,8 @@ void Mac1609_4::channelBusy()
     lastBusy = simTime();
 
     // channel turned busy
-    if (nextMacEvent->isScheduled() == true) {
-        cancelEvent(nextMacEvent);
-    }
-    else {
-        // the edca subsystem was not doing anything anyway.
-    }
-    myEDCA[activeChannel]->stopContent(true, false);
+    cancelNextMacEvent();
+    getEDCA(activeChannel).stopContent(true, false);
 
     emit(sigChannelBusy, true);
 }
@@ -941,7 +995,7 @@ void Mac1609_4::channelIdle(bool afterSwitch)
         return;
     }
 
-    if (nextMacEvent->isScheduled() == true) {
+    if (nextMacEventTime != -1) {
         // this rare case can happen when another node's time has such a big offset that the node sent a packet although we already changed the channel
         // the workaround is not trivial and requires a lot of changes to the phy and decider
         return;
@@ -965,16 +1019,16 @@ void Mac1609_4::channelIdle(bool afterSwitch)
     statsTotalBusyTime += simTime() - lastBusy;
 
     // get next Event from current EDCA subsystem
-    simtime_t nextEvent = myEDCA[activeChannel]->startContent(lastIdle, guardActive());
+    simtime_t nextEvent = getEDCA(activeChannel).startContent(lastIdle, guardActive());
     if (nextEvent != -1) {
-        if ((!useSCH) || (nextEvent < nextChannelSwitch->getArrivalTime())) {
-            scheduleAt(nextEvent, nextMacEvent);
-            EV_TRACE << "next Event is at " << nextMacEvent->getArrivalTime().raw() << std::endl;
+        if ((!useSCH) || (nextEvent < nextChannelSwitchTime)) {
+            scheduleNextMacEvent(nextEvent);
+            EV_TRACE << "next Event is at " << nextEvent.raw() << std::endl;
         }
         else {
             EV_TRACE << "Too little time in this interval. will not schedule macEvent" << std::endl;
             statsNumTooLittleTime++;
-            myEDCA[activeChannel]->revokeTxOPs();
+            getEDCA(activeChannel).revokeTxOPs();
         }
     }
     else {
@@ -1041,12 +1095,28 @@ void Mac1609_4::handleUnicast(LAddress::L2Type srcAddr, unique_ptr<BaseFrame1609
         sendAck(srcAddr, wsm->getTreeId());
     }
 
-    if (handledUnicastToApp.find(wsm->getTreeId()) == handledUnicastToApp.end()) {
-        handledUnicastToApp.insert(wsm->getTreeId());
-        EV_TRACE << "Received a data packet addressed to me." << std::endl;
-        statsReceivedPackets++;
-        sendUp(wsm.release());
+    // Like the duplicate detection of IEEE Std 802.11-2012 9.3.2.10, only remember the last frame per sender and queue:
+    // a sender retransmits nothing but the head of its queue, which stays blocked until the frame is acknowledged or dropped.
+    // Senders keep one queue per access category on each of CCH and SCH, and frames of these queues can interleave.
+    t_access_category ac = mapUserPriority(wsm->getUserPriority());
+    size_t chan = static_cast<size_t>((static_cast<Channel>(wsm->getChannelNumber()) == Channel::cch) ? ChannelType::control : ChannelType::service);
+    DeliveredUnicastIds delivered;
+    for (auto& ids : delivered) {
+        ids.fill(-1);
     }
+    if (const DeliveredUnicastIds* known = handledUnicastToApp.find(srcAddr)) {
+        delivered = *known;
+    }
+    if (delivered[chan][ac] == wsm->getTreeId()) {
+        EV_TRACE << "Dropping a duplicate of a data packet that was already handed to the application." << std::endl;
+        return;
+    }
+    delivered[chan][ac] = wsm->getTreeId();
+    handledUnicastToApp.insert(srcAddr, delivered);
+
+    EV_TRACE << "Received a data packet addressed to me." << std::endl;
+    statsReceivedPackets++;
+    sendUp(wsm.release());
 }
 
 void Mac1609_4::handleAck(const Mac80211Ack* ack)
@@ -1057,21 +1127,21 @@ void Mac1609_4::handleAck(const Mac80211Ack* ack)
 
     ChannelType chan = ChannelType::control;
     bool queueUnblocked = false;
-    for (auto&& p : myEDCA[chan]->myQueues) {
-        auto& accessCategory = p.first;
-        auto& edcaQueue = p.second;
+    for (int ac = AC_BK; ac <= AC_VO; ac++) {
+        t_access_category accessCategory = static_cast<t_access_category>(ac);
+        auto& edcaQueue = getEDCA(chan).myQueues[accessCategory];
         if (edcaQueue.queue.size() > 0 && edcaQueue.waitForAck && (edcaQueue.waitOnUnicastID == ack->getMessageId())) {
             BaseFrame1609_4* wsm = edcaQueue.queue.front();
             edcaQueue.queue.pop();
             delete wsm;
-            myEDCA[chan]->myQueues[accessCategory].cwCur = myEDCA[chan]->myQueues[accessCategory].cwMin;
-            myEDCA[chan]->backoff(accessCategory);
+            getEDCA(chan).myQueues[accessCategory].cwCur = getEDCA(chan).myQueues[accessCategory].cwMin;
+            getEDCA(chan).backoff(accessCategory);
             edcaQueue.ssrc = 0;
             edcaQueue.slrc = 0;
             edcaQueue.waitForAck = false;
             edcaQueue.waitOnUnicastID = -1;
-            if (myEDCA[chan]->myQueues[accessCategory].ackTimeOut->isScheduled()) {
-                cancelEvent(myEDCA[chan]->myQueues[accessCategory].ackTimeOut);
+            if (getEDCA(chan).myQueues[accessCategory].ackTimeOut->isScheduled()) {
+                cancelEvent(getEDCA(chan).myQueues[accessCategory].ackTimeOut);
             }
             queueUnblocked = true;
         }
@@ -1106,20 +1176,20 @@ void Mac1609_4::handleAckTimeOut(AckTimeOutMessage* ackTimeOutMsg)
 void Mac1609_4::handleRetransmit(t_access_category ac)
 {
     // cancel the acktime out
-    if (myEDCA[ChannelType::control]->myQueues[ac].ackTimeOut->isScheduled()) {
+    if (getEDCA(ChannelType::control).myQueues[ac].ackTimeOut->isScheduled()) {
         // This case is possible if we received PHY_RX_END_WITH_SUCCESS or FAILURE even before ack timeout
-        cancelEvent(myEDCA[ChannelType::control]->myQueues[ac].ackTimeOut);
+        cancelEvent(getEDCA(ChannelType::control).myQueues[ac].ackTimeOut);
     }
-    if (myEDCA[ChannelType::control]->myQueues[ac].queue.size() == 0) {
+    if (getEDCA(ChannelType::control).myQueues[ac].queue.size() == 0) {
         throw cRuntimeError("Trying retransmission on empty queue...");
     }
-    BaseFrame1609_4* appPkt = myEDCA[ChannelType::control]->myQueues[ac].queue.front();
+    BaseFrame1609_4* appPkt = getEDCA(ChannelType::control).myQueues[ac].queue.front();
     bool contend = false;
     bool retriesExceeded = false;
     // page 879 of IEEE 802.11-2012
     if (appPkt->getBitLength() <= dot11RTSThreshold) {
-        myEDCA[ChannelType::control]->myQueues[ac].ssrc++;
-        if (myEDCA[ChannelType::control]->myQueues[ac].ssrc <= dot11ShortRetryLimit) {
+        getEDCA(ChannelType::control).myQueues[ac].ssrc++;
+        if (getEDCA(ChannelType::control).myQueues[ac].ssrc <= dot11ShortRetryLimit) {
             retriesExceeded = false;
         }
         else {
@@ -1127,8 +1197,8 @@ void Mac1609_4::handleRetransmit(t_access_category ac)
         }
     }
     else {
-        myEDCA[ChannelType::control]->myQueues[ac].slrc++;
-        if (myEDCA[ChannelType::control]->myQueues[ac].slrc <= dot11LongRetryLimit) {
+        getEDCA(ChannelType::control).myQueues[ac].slrc++;
+        if (getEDCA(ChannelType::control).myQueues[ac].slrc <= dot11LongRetryLimit) {
             retriesExceeded = false;
         }
         else {
@@ -1137,16 +1207,16 @@ void Mac1609_4::handleRetransmit(t_access_category ac)
     }
     if (!retriesExceeded) {
         // try again!
-        myEDCA[ChannelType::control]->myQueues[ac].cwCur = std::min(myEDCA[ChannelType::control]->myQueues[ac].cwMax, (myEDCA[ChannelType::control]->myQueues[ac].cwCur * 2) + 1);
-        myEDCA[ChannelType::control]->backoff(ac);
+        getEDCA(ChannelType::control).myQueues[ac].cwCur = std::min(getEDCA(ChannelType::control).myQueues[ac].cwMax, (getEDCA(ChannelType::control).myQueues[ac].cwCur * 2) + 1);
+        getEDCA(ChannelType::control).backoff(ac);
         contend = true;
         // no need to reset wait on id here as we are still retransmitting same packet
-        myEDCA[ChannelType::control]->myQueues[ac].waitForAck = false;
+        getEDCA(ChannelType::control).myQueues[ac].waitForAck = false;
     }
     else {
         // enough tries!
-        myEDCA[ChannelType::control]->myQueues[ac].queue.pop();
-        if (myEDCA[ChannelType::control]->myQueues[ac].queue.size() > 0) {
+        getEDCA(ChannelType::control).myQueues[ac].queue.pop();
+        if (getEDCA(ChannelType::control).myQueues[ac].queue.size() > 0) {
             // start contention only if there are more packets in the queue
             contend = true;
         }
@@ -1154,19 +1224,18 @@ void Mac1609_4::handleRetransmit(t_access_category ac)
         emit(sigRetriesExceeded, appPkt);
         statsRetriesExceeded++;
         delete appPkt;
-        myEDCA[ChannelType::control]->myQueues[ac].cwCur = myEDCA[ChannelType::control]->myQueues[ac].cwMin;
-        myEDCA[ChannelType::control]->backoff(ac);
-        myEDCA[ChannelType::control]->myQueues[ac].waitForAck = false;
-        myEDCA[ChannelType::control]->myQueues[ac].waitOnUnicastID = -1;
-        myEDCA[ChannelType::control]->myQueues[ac].ssrc = 0;
-        myEDCA[ChannelType::control]->myQueues[ac].slrc = 0;
+        getEDCA(ChannelType::control).myQueues[ac].cwCur = getEDCA(ChannelType::control).myQueues[ac].cwMin;
+        getEDCA(ChannelType::control).backoff(ac);
+        getEDCA(ChannelType::control).myQueues[ac].waitForAck = false;
+        getEDCA(ChannelType::control).myQueues[ac].waitOnUnicastID = -1;
+        getEDCA(ChannelType::control).myQueues[ac].ssrc = 0;
+        getEDCA(ChannelType::control).myQueues[ac].slrc = 0;
     }
     waitUntilAckRXorTimeout = false;
     if (contend && idleChannel && !ignoreChannelState) {
         // reevaluate times -- if channel is not idle, then contention would start automatically
-        cancelEvent(nextMacEvent);
-        simtime_t nextEvent = myEDCA[ChannelType::control]->startContent(lastIdle, guardActive());
-        scheduleAt(nextEvent, nextMacEvent);
+        simtime_t nextEvent = getEDCA(ChannelType::control).startContent(lastIdle, guardActive());
+        scheduleNextMacEvent(nextEvent);
     }
 }
 
@@ -22,7 +22,7 @@
 
 #pragma once
 
-#include <queue>
+#include <array>
 #include <memory>
 #include <stdint.h>
 
@@ -41,6 +41,8 @@
 #include "veins/base/modules/BaseMacLayer.h"
 #include "veins/modules/utility/ConstsPhy.h"
 #include "veins/modules/utility/HasLogProxy.h"
+#include "veins/modules/utility/LruCache.h"
+#include "veins/modules/utility/RingBuffer.h"
 
 namespace veins {
 
@@ -64,6 +66,7 @@ namespace veins {
  */
 
 class DeciderResult80211;
+class ChannelSwitchScheduler;
 
 class VEINS_API Mac1609_4 : public BaseMacLayer, public DemoBaseApplLayerToMac1609_4Interface {
 
@@ -86,12 +89,13 @@ public:
         AC_VI = 2,
         AC_VO = 3
     };
+    static constexpr size_t numAccessCategories = AC_VO + 1;
 
     class VEINS_API EDCA : HasLogProxy {
     public:
         class VEINS_API EDCAQueue {
         public:
-            std::queue<BaseFrame1609_4*> queue;
+            RingBuffer<BaseFrame1609_4*> queue; // a frame handed to the PHY without a copy leaves nullptr in its slot until postTransmit
             int aifsn; // number of aifs slots for this queue
             int cwMin; // minimum contention window
             int cwMax; // maximum contention size
@@ -102,9 +106,20 @@ public:
             int slrc; // station long retry count
             bool waitForAck; // true if the queue is waiting for an acknowledgment for unicast
             unsigned long waitOnUnicastID; // unique id of unicast on which station is waiting
-            AckTimeOutMessage* ackTimeOut; // timer for retransmission on receiving no ACK
+            AckTimeOutMessage* ackTimeOut; // timer for retransmission on receiving no ACK; nullptr if the queue was never created
 
             EDCAQueue()
+                : aifsn(0)
+                , cwMin(0)
+                , cwMax(0)
+                , cwCur(0)
+                , currentBackoff(0)
+                , txOP(false)
+                , ssrc(0)
+                , slrc(0)
+                , waitForAck(false)
+                , waitOnUnicastID(-1)
+                , ackTimeOut(nullptr)
             {
             }
             EDCAQueue(int aifsn, int cwMin, int cwMax, t_access_category ac);
@@ -119,7 +134,7 @@ public:
         void backoff(t_access_category ac);
         simtime_t startContent(simtime_t idleSince, bool guardActive);
         void stopContent(bool allowBackoff, bool generateTxOp);
-        void postTransmit(t_access_category, BaseFrame1609_4* wsm, bool useAcks);
+        void postTransmit(t_access_category, bool waitForAck);
         void revokeTxOPs();
 
         /** @brief return the next packet to send, send all lower Queues into backoff */
@@ -127,7 +142,7 @@ public:
 
     public:
         cSimpleModule* owner;
-        std::map<t_access_category, EDCAQueue> myQueues;
+        std::array<EDCAQueue, numAccessCategories> myQueues; // indexed by t_access_category
         uint32_t maxQueueSize;
         simtime_t lastStart; // when we started the last contention;
         ChannelType channelType;
@@ -182,6 +197,13 @@ public:
      */
     void setCCAThreshold(double ccaThreshold_dBm);
 
+    /**
+     * @brief Switch between CCH and SCH; called every SWITCHING_INTERVAL_11P
+     *
+     * Called by nextChannelSwitch or, if channelSwitchSchedulerModule is set, by the ChannelSwitchScheduler.
+     */
+    void handleChannelSwitch();
+
 protected:
     /** @brief States of the channel selecting operation.*/
 
@@ -220,6 +242,23 @@ protected:
 
     bool guardActive() const;
 
+    /** @brief the EDCA subsystem of the given channel */
+    EDCA& getEDCA(ChannelType channelType)
+    {
+        return *myEDCA[static_cast<size_t>(channelType)];
+    }
+
+    /**
+     * @brief let nextMacEvent take effect at the given time
+     *
+     * An armed timer is only rescheduled if it would fire too late.
+     * If it fires too early, it is re-armed for the latest deadline.
+     */
+    void scheduleNextMacEvent(simtime_t time);
+
+    /** @brief let nextMacEvent have no effect, without removing it from the event queue */
+    void cancelNextMacEvent();
+
     void attachControlInfo(Mac80211Pkt* mac, Channel channelNr, MCS mcs, double txPower_mW);
 
     /** @brief maps a application layer priority (up) to an EDCA access category. */
@@ -244,12 +283,21 @@ protected:
     }
 
 protected:
-    /** @brief Self message to indicate that the current channel shall be switched.*/
+    /** @brief Self message to indicate that the current channel shall be switched (nullptr if a ChannelSwitchScheduler does this).*/
     cMessage* nextChannelSwitch;
 
+    /** @brief When the current channel was switched to (or the module was initialized) */
+    simtime_t lastChannelSwitchTime;
+
+    /** @brief When the current channel will be switched */
+    simtime_t nextChannelSwitchTime;
+
     /** @brief Self message to wake up at next MacEvent */
     cMessage* nextMacEvent;
 
+    /** @brief When nextMacEvent takes effect (-1 if it has none); it may be armed for an earlier time */
+    simtime_t nextMacEventTime;
+
     /** @brief Last time the channel went idle */
     simtime_t lastIdle;
     simtime_t lastBusy;
@@ -260,18 +308,19 @@ protected:
     /** @brief access category of last sent packet */
     t_access_category lastAC;
 
-    /** @brief pointer to last sent packet */
-    BaseFrame1609_4* lastWSM;
+    /** @brief whether the last sent packet blocks its queue until it is acknowledged */
+    bool lastWaitsForAck;
 
-    /** @brief pointer to last sent mac frame */
-    std::unique_ptr<Mac80211Pkt> lastMac;
+    /** @brief whether the last sent mac frame was an acknowledgement */
+    bool lastMacWasAck;
 
     int headerLength;
 
     bool useSCH;
     Channel mySCH;
 
-    std::map<ChannelType, std::unique_ptr<EDCA>> myEDCA;
+    /** @brief EDCA subsystems, indexed by ChannelType */
+    std::array<std::unique_ptr<EDCA>, 2> myEDCA;
 
     bool idleChannel;
 
@@ -315,7 +364,11 @@ protected:
 
     // Dont start contention immediately after finishing unicast TX. Wait until ack timeout/ ack Rx
     bool waitUntilAckRXorTimeout;
-    std::set<unsigned long> handledUnicastToApp;
+
+    /** @brief tree id of the last unicast frame handed to the application, per channel type and access category (-1 if none) */
+    using DeliveredUnicastIds = std::array<std::array<long, numAccessCategories>, 2>;
+    /** @brief last delivered unicast frames of the most recently heard senders, for duplicate detection */
+    LruCache<LAddress::L2Type, DeliveredUnicastIds> handledUnicastToApp;
 
     Mac80211pToPhy11pInterface* phy11p;
 };
@@ -34,6 +34,7 @@
 #include "veins/modules/mobility/traci/TraCIConstants.h"
 #include "veins/modules/mobility/traci/TraCIMobility.h"
 #include "veins/modules/obstacle/ObstacleControl.h"
+#include "veins/modules/utility/BinaryStream.h"
 #include "veins/modules/world/traci/trafficLight/TraCITrafficLightInterface.h"
 
 using namespace veins::TraCIConstants;
@@ -424,6 +425,11 @@ void TraCIScenarioManager::init_traci()
             {
                 // get list of polygons
                 std::list<std::string> ids = commandInterface->getPolygonIds();
+
+                // fetch supported polygons, hashing their types and shapes to look up a binary cache of a previous run
+                std::vector<std::pair<std::string, std::string>> typedIds;
+                std::vector<std::vector<Coord>> shapes;
+                ContentHash hash;
                 for (std::list<std::string>::iterator i = ids.begin(); i != ids.end(); ++i) {
                     std::string id = *i;
                     std::string typeId = commandInterface->polygon(id).getTypeId();
@@ -431,13 +437,29 @@ void TraCIScenarioManager::init_traci()
                     std::list<Coord> coords = commandInterface->polygon(id).getShape();
                     std::vector<Coord> shape;
                     std::copy(coords.begin(), coords.end(), std::back_inserter(shape));
+                    hash.add(id);
+                    hash.add(typeId);
+                    hash.add<uint64_t>(shape.size());
                     for (auto p : shape) {
+                        hash.add(p.x);
+                        hash.add(p.y);
+                        hash.add(p.z);
+                    }
+                    typedIds.emplace_back(id, typeId);
+                    shapes.push_back(std::move(shape));
+                }
+                std::string sourceKey = "traci\n" + std::to_string(hash.get());
+                if (obstacles->loadBinaryCache(sourceKey)) continue;
+
+                for (size_t i = 0; i < typedIds.size(); ++i) {
+                    for (auto p : shapes[i]) {
                         if ((p.x < 0) || (p.y < 0) || (p.x > world->getPgs()->x) || (p.y > world->getPgs()->y)) {
                             EV_WARN << "WARNING: Playground (" << world->getPgs()->x << ", " << world->getPgs()->y << ") will not fit radio obstacle at (" << p.x << ", " << p.y << ")" << endl;
                         }
                     }
-                    obstacles->addFromTypeAndShape(id, typeId, shape);
+                    obstacles->addFromTypeAndShape(typedIds[i].first, typedIds[i].second, shapes[i]);
                 }
+                obstacles->saveBinaryCache(sourceKey);
             }
         }
     }
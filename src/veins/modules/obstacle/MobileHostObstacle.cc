@@ -68,21 +68,32 @@ double segmentsIntersectAt(Coord p1From, Coord p1To, Coord p2From, Coord p2To)
 } // namespace
 
 MobileHostObstacle::Coords MobileHostObstacle::getShape(simtime_t t) const
+{
+    Coord p = getMobility()->getPositionAt(t);
+
+    Coords shape = getShapeOffsets();
+    for (auto& c : shape) {
+        c = p + c;
+    }
+
+    return shape;
+}
+
+MobileHostObstacle::Coords MobileHostObstacle::getShapeOffsets() const
 {
     double l = getLength();
     double o = getHostPositionOffset(); // this is the shift we have to undo in order to (given the OMNeT++ host position) get the car's front bumper position
     double w = getWidth() / 2;
     const BaseMobility* m = getMobility();
-    Coord p = m->getPositionAt(t);
     double a = Heading::fromCoord(m->getCurrentOrientation()).getRad();
 
-    Coords shape;
-    shape.push_back(p + Coord(-(l - o), -w).rotatedYaw(-a));
-    shape.push_back(p + Coord(+o, -w).rotatedYaw(-a));
-    shape.push_back(p + Coord(+o, +w).rotatedYaw(-a));
-    shape.push_back(p + Coord(-(l - o), +w).rotatedYaw(-a));
+    Coords offsets;
+    offsets.push_back(Coord(-(l - o), -w).rotatedYaw(-a));
+    offsets.push_back(Coord(+o, -w).rotatedYaw(-a));
+    offsets.push_back(Coord(+o, +w).rotatedYaw(-a));
+    offsets.push_back(Coord(-(l - o), +w).rotatedYaw(-a));
 
-    return shape;
+    return offsets;
 }
 
 bool MobileHostObstacle::maybeInBounds(double x1, double y1, double x2, double y2, simtime_t t) const
@@ -110,9 +121,12 @@ bool MobileHostObstacle::maybeInBounds(double x1, double y1, double x2, double y
 
 double MobileHostObstacle::getIntersectionPoint(const Coord& senderPos, const Coord& receiverPos, simtime_t t) const
 {
-    const double not_a_number = std::numeric_limits<double>::quiet_NaN();
+    return getIntersectionPoint(getShape(t), senderPos, receiverPos);
+}
 
-    MobileHostObstacle::Coords shape = getShape(t);
+double MobileHostObstacle::getIntersectionPoint(const Coords& shape, const Coord& senderPos, const Coord& receiverPos)
+{
+    const double not_a_number = std::numeric_limits<double>::quiet_NaN();
 
     // shortcut if sender is inside
     bool senderInside = isPointInObstacle(senderPos, shape);
@@ -98,6 +98,13 @@ public:
 
     Coords getShape(simtime_t t) const;
 
+    /**
+     * return corners of this obstacle relative to the host position, i.e., getShape(t) minus the host position at t
+     *
+     * stays the same for as long as the host's orientation does not change
+     */
+    Coords getShapeOffsets() const;
+
     bool maybeInBounds(double x1, double y1, double x2, double y2, simtime_t t) const;
 
     /**
@@ -105,6 +112,11 @@ public:
      */
     double getIntersectionPoint(const Coord& senderPos, const Coord& receiverPos, simtime_t t) const;
 
+    /**
+     * return closest point (in meters) along (senderPos--receiverPos) where an obstacle of the given shape overlaps, or NAN if it doesn't
+     */
+    static double getIntersectionPoint(const Coords& shape, const Coord& senderPos, const Coord& receiverPos);
+
 protected:
     /**
      * Positions with identiers for all antennas connected to the host of this obstacle.
@@ -21,6 +21,7 @@
 //
 
 #include <algorithm>
+#include <cstdint>
 
 #include "veins/modules/obstacle/Obstacle.h"
 
@@ -40,6 +41,19 @@ Obstacle::Obstacle(std::string id, std::string type, double attenuationPerCut, d
 void Obstacle::setShape(Coords shape)
 {
     coords = shape;
+
+    edges = Edges();
+    const size_t n = coords.size();
+    for (size_t k = 0; k < n; ++k) {
+        const Coord& from = coords[k];
+        const Coord& to = coords[(k + n - 1) % n];
+        edges.x0.push_back(from.x);
+        edges.y0.push_back(from.y);
+        edges.dx.push_back(to.x - from.x);
+        edges.dy.push_back(to.y - from.y);
+        edges.y1.push_back(to.y);
+    }
+
     bboxP1 = Coord(1e7, 1e7);
     bboxP2 = Coord(-1e7, -1e7);
     for (Coords::const_iterator i = coords.begin(); i != coords.end(); ++i) {
@@ -65,62 +79,94 @@ const Coord Obstacle::getBboxP2() const
     return bboxP2;
 }
 
-bool Obstacle::containsPoint(Coord point) const
+namespace {
+
+/**
+ * Return 1 if a horizontal ray from point towards +x crosses edge k (see Obstacle::Edges), 0 otherwise.
+ *
+ * Without branches, so loops over all edges can be vectorized.
+ * Counted as double to keep all lanes the same width.
+ */
+inline double crossesEdge(double x, double y, double x0, double y0, double dx, double dy, double y1)
 {
-    bool isInside = false;
-    const Obstacle::Coords& shape = getShape();
-    Obstacle::Coords::const_iterator i = shape.begin();
-    Obstacle::Coords::const_iterator j = (shape.rbegin() + 1).base();
-    for (; i != shape.end(); j = i++) {
-        bool inYRangeUp = (point.y >= i->y) && (point.y < j->y);
-        bool inYRangeDown = (point.y >= j->y) && (point.y < i->y);
-        bool inYRange = inYRangeUp || inYRangeDown;
-        if (!inYRange) continue;
-        bool intersects = point.x < (i->x + ((point.y - i->y) * (j->x - i->x) / (j->y - i->y)));
-        if (!intersects) continue;
-        isInside = !isInside;
-    }
-    return isInside;
+    bool inYRange = (y >= y0) ^ (y >= y1);
+    // only meaningful if in y range (where dy != 0)
+    bool leftOfEdge = x < (x0 + ((y - y0) * dx / dy));
+    return (inYRange & leftOfEdge) ? 1.0 : 0.0;
 }
 
-namespace {
-
-double segmentsIntersectAt(const Coord& p1From, const Coord& p1To, const Coord& p2From, const Coord& p2To)
+inline bool isOdd(double crossings)
 {
-    double p1x = p1To.x - p1From.x;
-    double p1y = p1To.y - p1From.y;
-    double p2x = p2To.x - p2From.x;
-    double p2y = p2To.y - p2From.y;
-    double p1p2x = p1From.x - p2From.x;
-    double p1p2y = p1From.y - p2From.y;
-    double D = (p1x * p2y - p1y * p2x);
+    return static_cast<uint64_t>(crossings) % 2 == 1;
+}
+
+} // namespace
 
-    double p1Frac = (p2x * p1p2y - p2y * p1p2x) / D;
-    if (p1Frac < 0 || p1Frac > 1) return -1;
+bool Obstacle::containsPoint(Coord point) const
+{
+    const size_t n = edges.x0.size();
+    const double* x0 = edges.x0.data();
+    const double* y0 = edges.y0.data();
+    const double* dx = edges.dx.data();
+    const double* dy = edges.dy.data();
+    const double* y1 = edges.y1.data();
+
+    const double px = point.x;
+    const double py = point.y;
+    double crossings = 0;
+    for (size_t k = 0; k < n; ++k) {
+        crossings += crossesEdge(px, py, x0[k], y0[k], dx[k], dy[k], y1[k]);
+    }
+    return isOdd(crossings);
+}
 
-    double p2Frac = (p1x * p1p2y - p1y * p1p2x) / D;
-    if (p2Frac < 0 || p2Frac > 1) return -1;
+void Obstacle::intersect(const Coord& senderPos, const Coord& receiverPos, std::vector<double>& intersectAt, bool& senderInside, bool& receiverInside) const
+{
+    const size_t n = edges.x0.size();
+    const double* x0 = edges.x0.data();
+    const double* y0 = edges.y0.data();
+    const double* dx = edges.dx.data();
+    const double* dy = edges.dy.data();
+    const double* y1 = edges.y1.data();
+
+    const double sx = senderPos.x;
+    const double sy = senderPos.y;
+    const double ex = receiverPos.x;
+    const double ey = receiverPos.y;
+    const double rx = ex - sx;
+    const double ry = ey - sy;
+
+    // pass 1 (vectorizable): fraction along the beam for each edge (or -1 if not hit) and containment of both endpoints
+    intersectAt.resize(n);
+    double* fractions = intersectAt.data();
+    double senderCrossings = 0;
+    double receiverCrossings = 0;
+    for (size_t k = 0; k < n; ++k) {
+        const double offsetX = sx - x0[k];
+        const double offsetY = sy - y0[k];
+        const double d = rx * dy[k] - ry * dx[k];
+        const double beamFrac = (dx[k] * offsetY - dy[k] * offsetX) / d;
+        const double edgeFrac = (rx * offsetY - ry * offsetX) / d;
+        const bool hit = !((beamFrac < 0) | (beamFrac > 1) | (edgeFrac < 0) | (edgeFrac > 1));
+        fractions[k] = hit ? beamFrac : -1;
+
+        senderCrossings += crossesEdge(sx, sy, x0[k], y0[k], dx[k], dy[k], y1[k]);
+        receiverCrossings += crossesEdge(ex, ey, x0[k], y0[k], dx[k], dy[k], y1[k]);
+    }
+    senderInside = isOdd(senderCrossings);
+    receiverInside = isOdd(receiverCrossings);
 
-    return p1Frac;
+    // pass 2: keep only edges that were hit
+    intersectAt.erase(std::remove(intersectAt.begin(), intersectAt.end(), -1), intersectAt.end());
+    std::sort(intersectAt.begin(), intersectAt.end());
 }
-} // namespace
 
 std::vector<double> Obstacle::getIntersections(const Coord& senderPos, const Coord& receiverPos) const
 {
     std::vector<double> intersectAt;
-    const Obstacle::Coords& shape = getShape();
-    Obstacle::Coords::const_iterator i = shape.begin();
-    Obstacle::Coords::const_iterator j = (shape.rbegin() + 1).base();
-    for (; i != shape.end(); j = i++) {
-        const Coord& c1 = *i;
-        const Coord& c2 = *j;
-
-        double i = segmentsIntersectAt(senderPos, receiverPos, c1, c2);
-        if (i != -1) {
-            intersectAt.push_back(i);
-        }
-    }
-    std::sort(intersectAt.begin(), intersectAt.end());
+    bool senderInside;
+    bool receiverInside;
+    intersect(senderPos, receiverPos, intersectAt, senderInside, receiverInside);
     return intersectAt;
 }
 
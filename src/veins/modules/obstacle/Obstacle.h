@@ -56,6 +56,15 @@ public:
      */
     std::vector<double> getIntersections(const Coord& senderPos, const Coord& receiverPos) const;
 
+    /**
+     * same as getIntersections and containsPoint for sender and receiver, but in a single pass over the obstacle's edges
+     *
+     * @param intersectAt cleared, then filled with the sorted points (in [0, 1]) where the beam intersects with this obstacle
+     * @param senderInside set to whether this obstacle contains the sender
+     * @param receiverInside set to whether this obstacle contains the receiver
+     */
+    void intersect(const Coord& senderPos, const Coord& receiverPos, std::vector<double>& intersectAt, bool& senderInside, bool& receiverInside) const;
+
     AnnotationManager::Annotation* visualRepresentation;
 
 protected:
@@ -66,6 +75,20 @@ protected:
     Coords coords;
     Coord bboxP1;
     Coord bboxP2;
+
+    /**
+     * edges of the polygon as structure of arrays, so loops over all edges can be vectorized.
+     *
+     * Edge k runs from coords[k] to the previous corner (wrapping around), i.e., from (x0, y0) to (x0 + dx, y1).
+     * The end point's y coordinate is kept to test containment exactly like the half-open intervals of containsPoint.
+     */
+    struct Edges {
+        std::vector<double> x0;
+        std::vector<double> y0;
+        std::vector<double> dx;
+        std::vector<double> dy;
+        std::vector<double> y1;
+    } edges;
 };
 
 } // namespace veins
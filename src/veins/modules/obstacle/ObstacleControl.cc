@@ -20,12 +20,20 @@
 // Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 //
 
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 #include <map>
+#include <random>
 #include <set>
 
 #include "veins/modules/obstacle/ObstacleControl.h"
 #include "veins/base/modules/BaseWorldUtility.h"
+#include "veins/base/utils/ThreadPool.h"
+#include "veins/modules/utility/BBoxRay.h"
+#include "veins/modules/utility/BinaryStream.h"
+#include "veins/modules/utility/MappedFile.h"
 
 using veins::ObstacleControl;
 
@@ -33,14 +41,33 @@ Define_Module(veins::ObstacleControl);
 
 namespace {
 
-veins::BBoxLookup rebuildBBoxLookup(const std::vector<std::unique_ptr<veins::Obstacle>>& obstacleOwner, int gridCellSize = 250)
+const uint32_t binaryCacheMagic = 0x53424f56; /**< "VOBS" on little endian hosts, so files from hosts of different byte order are not read */
+const uint32_t binaryCacheVersion = 1; /**< increase whenever the layout of binary cache files (or of the stored lookups) changes */
+const uint32_t shadowingMapMagic = 0x4d485356; /**< "VSHM" on little endian hosts */
+const uint32_t shadowingMapVersion = 1; /**< increase whenever the layout of shadowing map files changes */
+
+std::vector<veins::Obstacle*> getObstaclePointers(const std::vector<std::unique_ptr<veins::Obstacle>>& obstacleOwner)
 {
     std::vector<veins::Obstacle*> obstaclePointers;
     obstaclePointers.reserve(obstacleOwner.size());
     std::transform(obstacleOwner.begin(), obstacleOwner.end(), std::back_inserter(obstaclePointers), [](const std::unique_ptr<veins::Obstacle>& obstacle) { return obstacle.get(); });
+    return obstaclePointers;
+}
+
+veins::BBoxLookup::Box getBBox(veins::Obstacle* o)
+{
+    return veins::BBoxLookup::Box{{o->getBboxP1().x, o->getBboxP1().y}, {o->getBboxP2().x, o->getBboxP2().y}};
+}
+
+veins::BBoxLookup rebuildBBoxLookup(const std::vector<std::unique_ptr<veins::Obstacle>>& obstacleOwner, int gridCellSize = 250)
+{
     auto playgroundSize = veins::FindModule<veins::BaseWorldUtility*>::findGlobalModule()->getPgs();
-    auto bboxFunction = [](veins::Obstacle* o) { return veins::BBoxLookup::Box{{o->getBboxP1().x, o->getBboxP1().y}, {o->getBboxP2().x, o->getBboxP2().y}}; };
-    return veins::BBoxLookup(obstaclePointers, bboxFunction, playgroundSize->x, playgroundSize->y, gridCellSize);
+    return veins::BBoxLookup(getObstaclePointers(obstacleOwner), getBBox, playgroundSize->x, playgroundSize->y, gridCellSize);
+}
+
+veins::BVHLookup rebuildBVHLookup(const std::vector<std::unique_ptr<veins::Obstacle>>& obstacleOwner)
+{
+    return veins::BVHLookup(getObstaclePointers(obstacleOwner), getBBox);
 }
 
 } // anonymous namespace
@@ -56,21 +83,83 @@ void ObstacleControl::initialize(int stage)
         cacheEntries.clear();
         isBboxLookupDirty = true;
 
+        int cacheSize = par("attenuationCacheSize");
+        if (cacheSize < 0) {
+            throw cRuntimeError("attenuationCacheSize was %d, but must not be negative", cacheSize);
+        }
+        cacheEntries.setCapacity(cacheSize);
+        cacheQuantization = par("attenuationCacheQuantization");
+        if (cacheQuantization < 0) {
+            throw cRuntimeError("attenuationCacheQuantization was %f, but must not be negative", cacheQuantization);
+        }
+
         annotations = AnnotationManagerAccess().getIfExists();
         if (annotations) annotationGroup = annotations->createGroup("obstacles");
 
         obstaclesXml = par("obstacles");
+        std::string spatialIndexName = par("spatialIndex").stdstringValue();
+        if (spatialIndexName == "grid") {
+            spatialIndex = SpatialIndex::grid;
+        }
+        else if (spatialIndexName == "bvh") {
+            spatialIndex = SpatialIndex::bvh;
+        }
+        else {
+            throw cRuntimeError("spatialIndex was \"%s\", but must be \"grid\" or \"bvh\"", spatialIndexName.c_str());
+        }
         gridCellSize = par("gridCellSize");
         if (gridCellSize < 1) {
             throw cRuntimeError("gridCellSize was %d, but must be a positive integer number", gridCellSize);
         }
 
-        addFromXml(obstaclesXml);
+        std::string shadowingMapModeName = par("shadowingMapMode").stdstringValue();
+        if (shadowingMapModeName == "off") {
+            shadowingMapMode = ShadowingMapMode::off;
+        }
+        else if (shadowingMapModeName == "build") {
+            shadowingMapMode = ShadowingMapMode::build;
+        }
+        else if (shadowingMapModeName == "use") {
+            shadowingMapMode = ShadowingMapMode::use;
+        }
+        else {
+            throw cRuntimeError("shadowingMapMode was \"%s\", but must be \"off\", \"build\", or \"use\"", shadowingMapModeName.c_str());
+        }
+        shadowingMapFile = par("shadowingMapFile").stdstringValue();
+        if (shadowingMapMode != ShadowingMapMode::off && shadowingMapFile.empty()) {
+            throw cRuntimeError("shadowingMapMode was \"%s\", but no shadowingMapFile was given", shadowingMapModeName.c_str());
+        }
+        shadowingMapCellSize = par("shadowingMapCellSize");
+        if (!(shadowingMapCellSize > 0)) {
+            throw cRuntimeError("shadowingMapCellSize was %f, but must be positive", shadowingMapCellSize);
+        }
+        shadowingMapRange = par("shadowingMapRange");
+        if (shadowingMapRange < 0) {
+            throw cRuntimeError("shadowingMapRange was %f, but must not be negative", shadowingMapRange);
+        }
+        shadowingMapExactMargin = par("shadowingMapExactMargin");
+        shadowingMap = ShadowingMap();
+        isShadowingMapLoaded = false;
+
+        binaryCacheDir = par("binaryCacheDir").stdstringValue();
+        binaryCacheTag = par("binaryCacheTag").stdstringValue();
+
+        if (!loadBinaryCache("")) {
+            addFromXml(obstaclesXml);
+            saveBinaryCache("");
+        }
     }
 }
 
 void ObstacleControl::finish()
 {
+    if (cacheEntries.getCapacity() > 0) {
+        recordScalar("attenuationCacheHits", getCacheHits());
+        recordScalar("attenuationCacheMisses", getCacheMisses());
+    }
+    if (shadowingMapMode == ShadowingMapMode::build) {
+        buildShadowingMap();
+    }
     obstacleOwner.clear();
 }
 
@@ -164,13 +253,13 @@ void ObstacleControl::add(Obstacle obstacle)
     // visualize using AnnotationManager
     if (annotations) o->visualRepresentation = annotations->drawPolygon(o->getShape(), "red", annotationGroup);
 
-    cacheEntries.clear();
-    isBboxLookupDirty = true;
+    updateIndex(o, true);
 }
 
 void ObstacleControl::erase(const Obstacle* obstacle)
 {
     if (annotations && obstacle->visualRepresentation) annotations->erase(obstacle->visualRepresentation);
+    updateIndex(const_cast<Obstacle*>(obstacle), false);
     for (auto itOwner = obstacleOwner.begin(); itOwner != obstacleOwner.end(); ++itOwner) {
         // find owning pointer and remove it to deallocate obstacle
         if (itOwner->get() == obstacle) {
@@ -178,9 +267,205 @@ void ObstacleControl::erase(const Obstacle* obstacle)
             break;
         }
     }
+}
+
+void ObstacleControl::updateIndex(Obstacle* obstacle, bool added)
+{
+    generation++;
 
+    // nothing to update yet: the index will be built from all obstacles on first use
+    if (isBboxLookupDirty) {
+        cacheEntries.clear();
+        return;
+    }
+
+    const BBoxLookup::Box bbox = getBBox(obstacle);
+    if (spatialIndex == SpatialIndex::bvh) {
+        if (added) {
+            bvhLookup.insert(obstacle, bbox);
+        }
+        else {
+            bvhLookup.remove(obstacle);
+        }
+    }
+    else {
+        if (added) {
+            bboxLookup.insert(obstacle, bbox);
+        }
+        else {
+            bboxLookup.remove(obstacle);
+        }
+    }
+
+    // the shadowing map was built for the obstacles as loaded
+    if (!shadowingMap.empty()) {
+        EV_WARN << "Obstacles changed, no longer using shadowing map" << endl;
+        shadowingMap = ShadowingMap();
+    }
+
+    // only links whose beam touches the obstacle's bounding box can be affected
+    cacheEntries.eraseIf([&bbox](const CacheKey& key, double) {
+        const Ray ray = makeRay({key.senderPos.x, key.senderPos.y}, {key.receiverPos.x, key.receiverPos.y});
+        return intersects(ray, bbox);
+    });
+}
+
+std::string ObstacleControl::getBinaryCachePath(const std::string& sourceKey) const
+{
+    ContentHash hash;
+    hash.add(binaryCacheVersion);
+    hash.add<uint32_t>(sizeof(size_t));
+    hash.add(obstaclesXml->getXML());
+    hash.add(static_cast<int32_t>(spatialIndex));
+    hash.add<int32_t>(gridCellSize);
+    auto playgroundSize = FindModule<BaseWorldUtility*>::findGlobalModule()->getPgs();
+    hash.add(playgroundSize->x);
+    hash.add(playgroundSize->y);
+    hash.add(binaryCacheTag);
+    hash.add(sourceKey);
+
+    char name[32];
+    snprintf(name, sizeof(name), "obstacles-%016llx.bin", static_cast<unsigned long long>(hash.get()));
+    return binaryCacheDir + "/" + name;
+}
+
+bool ObstacleControl::loadBinaryCache(const std::string& sourceKey)
+{
+    if (binaryCacheDir.empty()) return false;
+    const std::string path = getBinaryCachePath(sourceKey);
+    MappedFile file(path);
+    if (!file.isOpen()) return false;
+
+    // parse everything before touching the current obstacles, so a damaged file leaves them as they are
+    std::map<std::string, double> loadedPerCut;
+    std::map<std::string, double> loadedPerMeter;
+    std::vector<std::unique_ptr<Obstacle>> loadedObstacles;
+    BBoxLookup loadedBboxLookup;
+    BVHLookup loadedBvhLookup;
+    try {
+        BinaryReader in(file.begin(), file.end());
+        if (in.read<uint32_t>() != binaryCacheMagic || in.read<uint32_t>() != binaryCacheVersion) return false;
+
+        const uint64_t numTypes = in.read<uint64_t>();
+        for (uint64_t i = 0; i < numTypes; ++i) {
+            std::string type = in.readString();
+            loadedPerCut[type] = in.read<double>();
+            loadedPerMeter[type] = in.read<double>();
+        }
+
+        const uint64_t numObstacles = in.read<uint64_t>();
+        std::vector<double> xyz;
+        for (uint64_t i = 0; i < numObstacles; ++i) {
+            std::string id = in.readString();
+            std::string type = in.readString();
+            if (loadedPerCut.find(type) == loadedPerCut.end()) {
+                throw cRuntimeError("Obstacle \"%s\" has unknown type \"%s\"", id.c_str(), type.c_str());
+            }
+            auto obs = make_unique<Obstacle>(id, type, loadedPerCut[type], loadedPerMeter[type]);
+            in.readArray(xyz);
+            Obstacle::Coords shape;
+            shape.reserve(xyz.size() / 3);
+            for (size_t k = 0; k + 2 < xyz.size(); k += 3) {
+                shape.emplace_back(xyz[k], xyz[k + 1], xyz[k + 2]);
+            }
+            obs->setShape(shape);
+            loadedObstacles.push_back(std::move(obs));
+        }
+
+        // the spatial index refers to obstacles by their position in the list of obstacles
+        const auto obstaclePointers = getObstaclePointers(loadedObstacles);
+        if (spatialIndex == SpatialIndex::bvh) {
+            loadedBvhLookup = BVHLookup::read(in, obstaclePointers);
+        }
+        else {
+            loadedBboxLookup = BBoxLookup::read(in, obstaclePointers);
+        }
+        if (!in.atEnd()) {
+            throw cRuntimeError("Binary obstacle cache has trailing data");
+        }
+    }
+    catch (const cRuntimeError& e) {
+        EV_WARN << "Ignoring damaged binary obstacle cache \"" << path << "\": " << e.what() << endl;
+        return false;
+    }
+
+    // replace all obstacles added so far
+    for (const auto& o : obstacleOwner) {
+        if (annotations && o->visualRepresentation) annotations->erase(o->visualRepresentation);
+    }
+    obstacleOwner = std::move(loadedObstacles);
+    perCut = std::move(loadedPerCut);
+    perMeter = std::move(loadedPerMeter);
+    bboxLookup = std::move(loadedBboxLookup);
+    bvhLookup = std::move(loadedBvhLookup);
+    isBboxLookupDirty = false;
     cacheEntries.clear();
+    generation++;
+    if (annotations) {
+        for (const auto& o : obstacleOwner) {
+            o->visualRepresentation = annotations->drawPolygon(o->getShape(), "red", annotationGroup);
+        }
+    }
+
+    EV_INFO << "Loaded " << obstacleOwner.size() << " obstacles from binary cache" << endl;
+    return true;
+}
+
+void ObstacleControl::saveBinaryCache(const std::string& sourceKey)
+{
+    if (binaryCacheDir.empty() || obstacleOwner.empty()) return;
+
+    // store a freshly built index, free of incremental updates
     isBboxLookupDirty = true;
+    prepareConcurrentAccess();
+
+    // write to a temporary file first, so concurrent runs only ever see complete files
+    const std::string path = getBinaryCachePath(sourceKey);
+    const std::string tempPath = path + ".tmp" + std::to_string(std::random_device()());
+    {
+        std::ofstream file(tempPath, std::ios::binary);
+        BinaryWriter out(file);
+        out.write(binaryCacheMagic);
+        out.write(binaryCacheVersion);
+
+        out.write<uint64_t>(perCut.size());
+        for (const auto& type : perCut) {
+            out.writeString(type.first);
+            out.write(type.second);
+            out.write(getAttenuationPerMeter(type.first));
+        }
+
+        out.write<uint64_t>(obstacleOwner.size());
+        std::vector<double> xyz;
+        for (const auto& o : obstacleOwner) {
+            out.writeString(o->getId());
+            out.writeString(o->getType());
+            xyz.clear();
+            for (const auto& c : o->getShape()) {
+                xyz.insert(xyz.end(), {c.x, c.y, c.z});
+            }
+            out.writeArray(xyz);
+        }
+
+        const auto obstaclePointers = getObstaclePointers(obstacleOwner);
+        if (spatialIndex == SpatialIndex::bvh) {
+            bvhLookup.write(out, obstaclePointers);
+        }
+        else {
+            bboxLookup.write(out, obstaclePointers);
+        }
+
+        file.close();
+        if (!file) {
+            EV_WARN << "Could not write binary obstacle cache \"" << tempPath << "\"" << endl;
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        EV_WARN << "Could not move binary obstacle cache to \"" << path << "\"" << endl;
+        std::remove(tempPath.c_str());
+    }
 }
 
 std::vector<std::pair<veins::Obstacle*, std::vector<double>>> ObstacleControl::getIntersections(const Coord& senderPos, const Coord& receiverPos) const
@@ -188,32 +473,86 @@ std::vector<std::pair<veins::Obstacle*, std::vector<double>>> ObstacleControl::g
     std::vector<std::pair<Obstacle*, std::vector<double>>> allIntersections;
 
     // rebuild bounding box lookup structure if dirty (new obstacles added recently)
-    if (isBboxLookupDirty) {
-        bboxLookup = rebuildBBoxLookup(obstacleOwner);
-        isBboxLookupDirty = false;
-    }
+    prepareConcurrentAccess();
 
-    auto candidateObstacles = bboxLookup.findOverlapping({senderPos.x, senderPos.y}, {receiverPos.x, receiverPos.y});
-
-    // remove duplicates
-    sort(candidateObstacles.begin(), candidateObstacles.end());
-    candidateObstacles.erase(unique(candidateObstacles.begin(), candidateObstacles.end()), candidateObstacles.end());
+    // reuse buffer across queries (one per thread, see ThreadPool)
+    thread_local std::vector<Obstacle*> candidateObstacles;
+    findCandidates(senderPos, receiverPos, candidateObstacles);
 
+    std::vector<double> foundIntersections;
     for (Obstacle* o : candidateObstacles) {
         // if obstacles has neither borders nor matter: bail.
         if (o->getShape().size() < 2) continue;
-        auto foundIntersections = o->getIntersections(senderPos, receiverPos);
-        if (!foundIntersections.empty() || o->containsPoint(senderPos) || o->containsPoint(receiverPos)) {
+        bool senderInside;
+        bool receiverInside;
+        o->intersect(senderPos, receiverPos, foundIntersections, senderInside, receiverInside);
+        if (!foundIntersections.empty() || senderInside || receiverInside) {
             allIntersections.emplace_back(o, foundIntersections);
         }
     }
     return allIntersections;
 }
 
+void ObstacleControl::prepareConcurrentAccess() const
+{
+    if (isBboxLookupDirty) {
+        if (spatialIndex == SpatialIndex::bvh) {
+            bvhLookup = rebuildBVHLookup(obstacleOwner);
+        }
+        else {
+            bboxLookup = rebuildBBoxLookup(obstacleOwner, gridCellSize);
+        }
+        isBboxLookupDirty = false;
+    }
+    if (shadowingMapMode == ShadowingMapMode::use && !isShadowingMapLoaded) {
+        loadShadowingMap();
+        isShadowingMapLoaded = true;
+    }
+}
+
+void ObstacleControl::findCandidates(const Coord& senderPos, const Coord& receiverPos, std::vector<Obstacle*>& result) const
+{
+    if (spatialIndex == SpatialIndex::bvh) {
+        bvhLookup.findOverlapping({senderPos.x, senderPos.y}, {receiverPos.x, receiverPos.y}, result);
+    }
+    else {
+        // reuse mailbox across queries (one per thread, see ThreadPool)
+        thread_local BBoxLookup::Mailbox mailbox;
+        bboxLookup.findOverlapping({senderPos.x, senderPos.y}, {receiverPos.x, receiverPos.y}, result, mailbox);
+    }
+}
+
+uint64_t ObstacleControl::getCacheHits() const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return cacheEntries.getHits();
+}
+
+uint64_t ObstacleControl::getCacheMisses() const
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return cacheEntries.getMisses();
+}
+
+Coord ObstacleControl::quantize(const Coord& pos) const
+{
+    if (cacheQuantization <= 0) return pos;
+    return Coord(std::round(pos.x / cacheQuantization) * cacheQuantization, std::round(pos.y / cacheQuantization) * cacheQuantization, pos.z);
+}
+
 double ObstacleControl::calculateAttenuation(const Coord& senderPos, const Coord& receiverPos) const
 {
+    // worker threads must not switch the simulation's context
+    if (ThreadPool::isInParallelSection()) {
+        return computeAttenuation(quantize(senderPos), quantize(receiverPos));
+    }
+
     Enter_Method_Silent();
+    return computeAttenuation(quantize(senderPos), quantize(receiverPos));
+}
 
+double ObstacleControl::computeAttenuation(const Coord& senderPos, const Coord& receiverPos) const
+{
     if ((perCut.size() == 0) || (perMeter.size() == 0)) {
         throw cRuntimeError("Unable to use SimpleObstacleShadowing: No obstacle types have been configured");
     }
@@ -221,24 +560,54 @@ double ObstacleControl::calculateAttenuation(const Coord& senderPos, const Coord
         throw cRuntimeError("Unable to use SimpleObstacleShadowing: No obstacles have been added");
     }
 
+    // look up precomputed attenuation, if available
+    if (shadowingMapMode == ShadowingMapMode::use) {
+        prepareConcurrentAccess();
+        double attenuation;
+        if (shadowingMap.lookup(senderPos, receiverPos, shadowingMapExactMargin, attenuation)) {
+            return pow(10.0, -attenuation / 10.0);
+        }
+    }
+
     // return cached result, if available
     CacheKey cacheKey(senderPos, receiverPos);
-    CacheEntries::const_iterator cacheEntryIter = cacheEntries.find(cacheKey);
-    if (cacheEntryIter != cacheEntries.end()) {
-        return cacheEntryIter->second;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (const double* cached = cacheEntries.find(cacheKey)) {
+            return *cached;
+        }
+    }
+
+    double factor = computeExactAttenuation(senderPos, receiverPos);
+
+    // cache result
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cacheEntries.insert(cacheKey, factor);
     }
 
-    // get intersections
-    auto intersections = getIntersections(senderPos, receiverPos);
+    return factor;
+}
+
+double ObstacleControl::computeExactAttenuation(const Coord& senderPos, const Coord& receiverPos) const
+{
+    // get candidate obstacles
+    prepareConcurrentAccess();
+    thread_local std::vector<Obstacle*> candidateObstacles;
+    thread_local std::vector<double> intersectAt;
+    findCandidates(senderPos, receiverPos, candidateObstacles);
 
     double factor = 1;
-    for (auto i = intersections.begin(); i != intersections.end(); ++i) {
-        auto o = i->first;
-        auto intersectAt = i->second;
+    for (Obstacle* o : candidateObstacles) {
+        // if obstacles has neither borders nor matter: bail.
+        if (o->getShape().size() < 2) continue;
+
+        // intersect beam with obstacle in a single pass over its edges
+        bool senderInside;
+        bool receiverInside;
+        o->intersect(senderPos, receiverPos, intersectAt, senderInside, receiverInside);
 
         // if beam interacts with neither borders nor matter: bail.
-        bool senderInside = o->containsPoint(senderPos);
-        bool receiverInside = o->containsPoint(receiverPos);
         if ((intersectAt.size() == 0) && !senderInside && !receiverInside) continue;
 
         // remember number of cuts before messing with intersection points
@@ -266,13 +635,70 @@ double ObstacleControl::calculateAttenuation(const Coord& senderPos, const Coord
         if (factor < 1e-30) break;
     }
 
-    // cache result
-    if (cacheEntries.size() >= 1000) cacheEntries.clear();
-    cacheEntries[cacheKey] = factor;
-
     return factor;
 }
 
+uint64_t ObstacleControl::getObstaclesHash() const
+{
+    ContentHash hash;
+    hash.add<uint64_t>(obstacleOwner.size());
+    for (const auto& o : obstacleOwner) {
+        hash.add(o->getId());
+        hash.add(o->getType());
+        hash.add(o->getAttenuationPerCut());
+        hash.add(o->getAttenuationPerMeter());
+        hash.add<uint64_t>(o->getShape().size());
+        for (const auto& c : o->getShape()) {
+            hash.add(c.x);
+            hash.add(c.y);
+        }
+    }
+    return hash.get();
+}
+
+void ObstacleControl::buildShadowingMap()
+{
+    if (obstacleOwner.size() == 0) {
+        throw cRuntimeError("Unable to build shadowing map: No obstacles have been added");
+    }
+    prepareConcurrentAccess();
+
+    auto world = FindModule<BaseWorldUtility*>::findGlobalModule();
+    const ShadowingMap map(
+        world->getPgs()->x, world->getPgs()->y, shadowingMapCellSize, shadowingMapRange, [this](const Coord& senderPos, const Coord& receiverPos) {
+            return -10 * log10(computeExactAttenuation(senderPos, receiverPos));
+        },
+        &world->getThreadPool());
+
+    std::ofstream file(shadowingMapFile, std::ios::binary);
+    BinaryWriter out(file);
+    out.write(shadowingMapMagic);
+    out.write(shadowingMapVersion);
+    out.write(getObstaclesHash());
+    map.write(out);
+    file.close();
+    if (!file) {
+        throw cRuntimeError("Could not write shadowing map \"%s\"", shadowingMapFile.c_str());
+    }
+    EV_INFO << "Wrote shadowing map for " << obstacleOwner.size() << " obstacles to \"" << shadowingMapFile << "\"" << endl;
+}
+
+void ObstacleControl::loadShadowingMap() const
+{
+    MappedFile file(shadowingMapFile);
+    if (!file.isOpen()) {
+        throw cRuntimeError("Could not open shadowing map \"%s\"", shadowingMapFile.c_str());
+    }
+    BinaryReader in(file.begin(), file.end());
+    if (in.read<uint32_t>() != shadowingMapMagic || in.read<uint32_t>() != shadowingMapVersion) {
+        throw cRuntimeError("\"%s\" is not a shadowing map of this version", shadowingMapFile.c_str());
+    }
+    if (in.read<uint64_t>() != getObstaclesHash()) {
+        throw cRuntimeError("Shadowing map \"%s\" was built for different obstacles, rebuild it with shadowingMapMode = \"build\"", shadowingMapFile.c_str());
+    }
+    shadowingMap = ShadowingMap::read(in);
+}
+
 double ObstacleControl::getAttenuationPerCut(std::string type)
 {
     if (perCut.find(type) != perCut.end())
@@ -23,13 +23,17 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "veins/veins.h"
 
 #include "veins/base/utils/Coord.h"
 #include "veins/modules/obstacle/Obstacle.h"
+#include "veins/modules/obstacle/ShadowingMap.h"
 #include "veins/modules/world/annotations/AnnotationManager.h"
 #include "veins/modules/utility/BBoxLookup.h"
+#include "veins/modules/utility/BVHLookup.h"
+#include "veins/modules/utility/LruCache.h"
 
 namespace veins {
 
@@ -70,7 +74,94 @@ public:
      */
     double calculateAttenuation(const Coord& senderPos, const Coord& receiverPos) const;
 
+    /**
+     * rebuild lookup structures if necessary, so calculateAttenuation can be called from several threads at once (see ThreadPool)
+     */
+    void prepareConcurrentAccess() const;
+
+    /**
+     * replace all obstacles (and types) by those stored in the binary cache for the current inputs and sourceKey, along with their spatial index
+     *
+     * The file is read through a memory mapping, which is released before returning: obstacles and index are copied onto the heap, so nothing is shared between concurrent runs beyond the page cache.
+     *
+     * @param sourceKey identifies obstacles added besides those of the obstacles parameter (e.g., fetched via TraCI), empty if there are none
+     * @return false if the binary cache is disabled or holds no intact file for these inputs, in which case the current obstacles are kept
+     */
+    bool loadBinaryCache(const std::string& sourceKey);
+
+    /**
+     * store all obstacles (and types) along with a freshly built spatial index in the binary cache for the current inputs and sourceKey (see loadBinaryCache)
+     *
+     * Does nothing if the binary cache is disabled or there are no obstacles.
+     */
+    void saveBinaryCache(const std::string& sourceKey);
+
+    /**
+     * number of calls to calculateAttenuation that were answered from the cache
+     */
+    uint64_t getCacheHits() const;
+
+    /**
+     * number of calls to calculateAttenuation that had to compute the attenuation
+     */
+    uint64_t getCacheMisses() const;
+
+    /**
+     * number of times obstacles were added or erased, so attenuation cached elsewhere can tell whether it is stale
+     */
+    uint64_t getGeneration() const
+    {
+        return generation;
+    }
+
 protected:
+    /**
+     * calculateAttenuation without switching the simulation's context
+     */
+    double computeAttenuation(const Coord& senderPos, const Coord& receiverPos) const;
+
+    /**
+     * calculateAttenuation by casting a ray against all obstacles, bypassing the attenuation cache and shadowing map
+     */
+    double computeExactAttenuation(const Coord& senderPos, const Coord& receiverPos) const;
+
+    /**
+     * hash of all obstacles (ids, types, attenuation, and shapes), to tell whether a shadowing map was built for them
+     */
+    uint64_t getObstaclesHash() const;
+
+    /**
+     * compute the shadowing map for all obstacles and write it to shadowingMapFile
+     */
+    void buildShadowingMap();
+
+    /**
+     * read the shadowing map from shadowingMapFile, making sure it was built for the current obstacles
+     */
+    void loadShadowingMap() const;
+
+    /**
+     * update the spatial index and attenuation cache after adding or removing obstacle (if the index has already been built)
+     */
+    void updateIndex(Obstacle* obstacle, bool added);
+
+    /**
+     * collect obstacles whose bounding box is crossed by the line between sender and receiver, using the configured spatial index
+     *
+     * The index must be up to date (see prepareConcurrentAccess).
+     */
+    void findCandidates(const Coord& senderPos, const Coord& receiverPos, std::vector<Obstacle*>& result) const;
+
+    /**
+     * path of the binary cache file for the current inputs (obstacles parameter, spatial index settings, playground size, binaryCacheTag) and sourceKey
+     */
+    std::string getBinaryCachePath(const std::string& sourceKey) const;
+
+    /**
+     * snap x and y coordinates of pos to the attenuation cache's quantization grid (if any)
+     */
+    Coord quantize(const Coord& pos) const;
+
     struct CacheKey {
         const Coord senderPos;
         const Coord receiverPos;
@@ -81,24 +172,45 @@ protected:
         {
         }
 
-        bool operator<(const CacheKey& o) const
+        bool operator==(const CacheKey& o) const
         {
-            if (senderPos.x < o.senderPos.x) return true;
-            if (senderPos.x > o.senderPos.x) return false;
-            if (senderPos.y < o.senderPos.y) return true;
-            if (senderPos.y > o.senderPos.y) return false;
-            if (receiverPos.x < o.receiverPos.x) return true;
-            if (receiverPos.x > o.receiverPos.x) return false;
-            if (receiverPos.y < o.receiverPos.y) return true;
-            if (receiverPos.y > o.receiverPos.y) return false;
-            return false;
+            return senderPos.x == o.senderPos.x && senderPos.y == o.senderPos.y && receiverPos.x == o.receiverPos.x && receiverPos.y == o.receiverPos.y;
         }
+
+        struct Hash {
+            size_t operator()(const CacheKey& k) const
+            {
+                size_t h = 0;
+                for (double v : {k.senderPos.x, k.senderPos.y, k.receiverPos.x, k.receiverPos.y}) {
+                    h ^= std::hash<double>()(v) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+                }
+                return h;
+            }
+        };
     };
 
-    typedef std::map<CacheKey, double> CacheEntries;
+    typedef LruCache<CacheKey, double, CacheKey::Hash> CacheEntries;
 
     cXMLElement* obstaclesXml; /**< obstacles to add at startup */
     int gridCellSize = 250; /**< size of square grid tiles for obstacle store */
+    /** spatial index used to find obstacles that might be crossed by a beam */
+    enum class SpatialIndex {
+        grid, ///< uniform grid, see BBoxLookup
+        bvh ///< bounding volume hierarchy, see BVHLookup
+    } spatialIndex = SpatialIndex::grid;
+    std::string binaryCacheDir; /**< directory of binary cache files (empty to disable) */
+    std::string binaryCacheTag; /**< user-supplied part of the binary cache key */
+    /** how attenuation is precomputed between pairs of cells, see ShadowingMap */
+    enum class ShadowingMapMode {
+        off, ///< always cast rays
+        build, ///< cast rays, but build a shadowing map for all obstacles at the end of the simulation
+        use ///< look up attenuation in the shadowing map, cast rays only for pairs of positions it does not cover
+    } shadowingMapMode = ShadowingMapMode::off;
+    std::string shadowingMapFile; /**< file the shadowing map is written to or read from */
+    double shadowingMapCellSize = 25; /**< size (in m) of square cells of the shadowing map to build */
+    double shadowingMapRange = 500; /**< largest distance (in m) between cells to precompute attenuation for */
+    double shadowingMapExactMargin = 0; /**< cast rays if sender or receiver is closer than this (in m) to a border of its cell in the shadowing map */
+    double cacheQuantization = 0; /**< grid size (in m) sender and receiver positions are snapped to before computing attenuation (0 to disable) */
 
     std::vector<std::unique_ptr<Obstacle>> obstacleOwner;
     AnnotationManager* annotations;
@@ -106,8 +218,13 @@ protected:
     std::map<std::string, double> perCut;
     std::map<std::string, double> perMeter;
     mutable CacheEntries cacheEntries;
+    mutable std::mutex cacheMutex; /**< guards cacheEntries (including its statistics) during concurrent calls of calculateAttenuation */
     mutable BBoxLookup bboxLookup;
+    mutable BVHLookup bvhLookup;
     mutable bool isBboxLookupDirty = true;
+    mutable ShadowingMap shadowingMap;
+    mutable bool isShadowingMapLoaded = false;
+    uint64_t generation = 0; /**< see getGeneration */
 };
 
 class VEINS_API ObstacleControlAccess {
@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/modules/obstacle/ShadowingMap.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "veins/base/utils/ThreadPool.h"
+#include "veins/modules/utility/BinaryStream.h"
+
+namespace {
+
+const double resolution = 0.5; /**< in dB */
+const uint8_t saturated = 254; /**< attenuation of at least saturated * resolution */
+const uint8_t notCovered = 255; /**< pair of cells farther apart than range or outside of the playground */
+
+uint8_t quantize(double attenuation)
+{
+    if (!(attenuation < saturated * resolution)) return saturated;
+    return static_cast<uint8_t>(std::lround(std::max(0.0, attenuation) / resolution));
+}
+
+} // anonymous namespace
+
+namespace veins {
+
+ShadowingMap::ShadowingMap(double sizeX, double sizeY, double cellSize, double range, AttenuationFunction attenuation, ThreadPool* pool)
+    : cellSize(cellSize)
+    , range(range)
+    , numCols(static_cast<uint32_t>(std::floor(sizeX / cellSize)) + 1)
+    , numRows(static_cast<uint32_t>(std::floor(sizeY / cellSize)) + 1)
+    , radius(static_cast<uint32_t>(std::ceil(range / cellSize)))
+{
+    ASSERT(cellSize > 0);
+    ASSERT(range >= 0);
+    const size_t windowSize = 2 * radius + 1;
+    values.assign(size_t(numCols) * numRows * windowSize * windowSize, notCovered);
+
+    auto computeCell = [&](size_t cellIndex) {
+        const uint32_t col = cellIndex % numCols;
+        const uint32_t row = cellIndex / numCols;
+        const Coord center((col + 0.5) * cellSize, (row + 0.5) * cellSize);
+        for (int dRow = -int(radius); dRow <= int(radius); ++dRow) {
+            if (int(row) + dRow < 0 || int(row) + dRow >= int(numRows)) continue;
+            for (int dCol = -int(radius); dCol <= int(radius); ++dCol) {
+                if (int(col) + dCol < 0 || int(col) + dCol >= int(numCols)) continue;
+                if (std::hypot(dCol * cellSize, dRow * cellSize) > range) continue;
+                // attenuation is symmetric, so each pair is computed once (by the cell with the lower index)
+                if (col + dCol + (row + dRow) * size_t(numCols) < cellIndex) continue;
+                const Coord other(center.x + dCol * cellSize, center.y + dRow * cellSize);
+                values[indexOf(col, row, dCol, dRow)] = values[indexOf(col + dCol, row + dRow, -dCol, -dRow)] = quantize(attenuation(center, other));
+            }
+        }
+    };
+
+    const size_t numCells = size_t(numCols) * numRows;
+    if (pool) {
+        pool->parallelFor(numCells, computeCell);
+    }
+    else {
+        for (size_t i = 0; i < numCells; ++i) computeCell(i);
+    }
+}
+
+bool ShadowingMap::locate(const Coord& pos, uint32_t& col, uint32_t& row, double& borderDistance) const
+{
+    if (!(pos.x >= 0 && pos.y >= 0)) return false;
+    const double x = pos.x / cellSize;
+    const double y = pos.y / cellSize;
+    if (!(x < numCols && y < numRows)) return false;
+    col = static_cast<uint32_t>(x);
+    row = static_cast<uint32_t>(y);
+    const double fx = x - col;
+    const double fy = y - row;
+    borderDistance = std::min(std::min(fx, 1 - fx), std::min(fy, 1 - fy)) * cellSize;
+    return true;
+}
+
+bool ShadowingMap::lookup(const Coord& senderPos, const Coord& receiverPos, double exactMargin, double& attenuation) const
+{
+    if (values.empty()) return false;
+    uint32_t senderCol, senderRow, receiverCol, receiverRow;
+    double senderBorderDistance, receiverBorderDistance;
+    if (!locate(senderPos, senderCol, senderRow, senderBorderDistance)) return false;
+    if (!locate(receiverPos, receiverCol, receiverRow, receiverBorderDistance)) return false;
+    if (senderBorderDistance < exactMargin || receiverBorderDistance < exactMargin) return false;
+    const int dCol = int(receiverCol) - int(senderCol);
+    const int dRow = int(receiverRow) - int(senderRow);
+    if (std::abs(dCol) > int(radius) || std::abs(dRow) > int(radius)) return false;
+    const uint8_t value = values[indexOf(senderCol, senderRow, dCol, dRow)];
+    if (value == notCovered) return false;
+    attenuation = value * resolution;
+    return true;
+}
+
+void ShadowingMap::write(BinaryWriter& out) const
+{
+    out.write(cellSize);
+    out.write(range);
+    out.write(numCols);
+    out.write(numRows);
+    out.write(radius);
+
+    // most neighbors of a cell see no or the same few buildings, so runs of equal values are long
+    std::vector<uint8_t> runValues;
+    std::vector<uint32_t> runLengths;
+    for (size_t i = 0; i < values.size();) {
+        size_t end = i + 1;
+        while (end < values.size() && values[end] == values[i] && end - i < UINT32_MAX) ++end;
+        runValues.push_back(values[i]);
+        runLengths.push_back(static_cast<uint32_t>(end - i));
+        i = end;
+    }
+    out.writeArray(runValues);
+    out.writeArray(runLengths);
+}
+
+ShadowingMap ShadowingMap::read(BinaryReader& in)
+{
+    ShadowingMap map;
+    map.cellSize = in.read<double>();
+    map.range = in.read<double>();
+    map.numCols = in.read<uint32_t>();
+    map.numRows = in.read<uint32_t>();
+    map.radius = in.read<uint32_t>();
+
+    std::vector<uint8_t> runValues;
+    std::vector<uint32_t> runLengths;
+    in.readArray(runValues);
+    in.readArray(runLengths);
+    if (runValues.size() != runLengths.size()) {
+        throw cRuntimeError("Stored shadowing map is inconsistent");
+    }
+    const size_t windowSize = 2 * map.radius + 1;
+    const size_t numValues = size_t(map.numCols) * map.numRows * windowSize * windowSize;
+    map.values.reserve(numValues);
+    for (size_t i = 0; i < runValues.size(); ++i) {
+        if (runLengths[i] > numValues - map.values.size()) {
+            throw cRuntimeError("Stored shadowing map is inconsistent");
+        }
+        map.values.insert(map.values.end(), runLengths[i], runValues[i]);
+    }
+    if (map.values.size() != numValues || !(map.cellSize > 0)) {
+        throw cRuntimeError("Stored shadowing map is inconsistent");
+    }
+    return map;
+}
+
+} // namespace veins
@@ -0,0 +1,119 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/base/utils/Coord.h"
+
+namespace veins {
+
+class BinaryReader;
+class BinaryWriter;
+class ThreadPool;
+
+/**
+ * Precomputed attenuation by obstacles between pairs of square cells of the playground.
+ *
+ * Stores the attenuation between the centers of every pair of cells at most a given range apart, so it can be looked up instead of ray casting.
+ * Values are kept in steps of 0.5 dB (up to 126.5 dB, higher attenuation saturates at 127 dB).
+ * Only considers x and y coordinates.
+ */
+class VEINS_API ShadowingMap {
+public:
+    using AttenuationFunction = std::function<double(const Coord& senderPos, const Coord& receiverPos)>;
+
+    ShadowingMap() = default;
+
+    /**
+     * Compute the map for a playground of sizeX by sizeY.
+     *
+     * @param attenuation returns the attenuation (in dB) between two positions; called for the centers of all pairs of cells at most range apart
+     * @param pool if given, attenuation is called from all of its threads at once
+     */
+    ShadowingMap(double sizeX, double sizeY, double cellSize, double range, AttenuationFunction attenuation, ThreadPool* pool = nullptr);
+
+    /**
+     * Look up the attenuation (in dB) between the cells containing senderPos and receiverPos.
+     *
+     * @param exactMargin refuse to answer if a position is closer than this to a border of its cell (so the caller can compute exact values there)
+     * @return false if the map does not cover this pair of positions
+     */
+    bool lookup(const Coord& senderPos, const Coord& receiverPos, double exactMargin, double& attenuation) const;
+
+    bool empty() const
+    {
+        return values.empty();
+    }
+
+    double getCellSize() const
+    {
+        return cellSize;
+    }
+
+    double getRange() const
+    {
+        return range;
+    }
+
+    /**
+     * Write this map to out, compressing runs of equal values.
+     */
+    void write(BinaryWriter& out) const;
+
+    /**
+     * Read a map written by write().
+     */
+    static ShadowingMap read(BinaryReader& in);
+
+private:
+    /**
+     * Index into values for the pair of cells (col, row) and (col + dCol, row + dRow).
+     */
+    size_t indexOf(uint32_t col, uint32_t row, int dCol, int dRow) const
+    {
+        const size_t windowSize = 2 * radius + 1;
+        return (col + row * size_t(numCols)) * windowSize * windowSize + (dRow + radius) * windowSize + (dCol + radius);
+    }
+
+    /**
+     * Cell containing pos and the distance of pos to the nearest border of this cell.
+     *
+     * @return false if pos is outside the playground
+     */
+    bool locate(const Coord& pos, uint32_t& col, uint32_t& row, double& borderDistance) const;
+
+    double cellSize = 0;
+    double range = 0;
+    uint32_t numCols = 0;
+    uint32_t numRows = 0;
+    uint32_t radius = 0; /**< largest offset (in cells) of a covered pair of cells along each axis */
+    std::vector<uint8_t> values; /**< per cell: a window of (2 radius + 1)^2 quantized values for the cells around it */
+};
+
+} // namespace veins
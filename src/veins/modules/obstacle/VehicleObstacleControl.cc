@@ -24,6 +24,8 @@
 #include <map>
 #include <set>
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <cmath>
 
@@ -31,17 +33,101 @@
 #include "veins/base/modules/BaseMobility.h"
 #include "veins/base/connectionManager/ChannelAccess.h"
 #include "veins/base/toolbox/Signal.h"
+#include "veins/base/toolbox/Spectrum.h"
+#include "veins/base/utils/ThreadPool.h"
 
+using veins::BaseMobility;
+using veins::Coord;
 using veins::MobileHostObstacle;
 using veins::Signal;
 using veins::VehicleObstacleControl;
 
 Define_Module(veins::VehicleObstacleControl);
 
-VehicleObstacleControl::~VehicleObstacleControl() = default;
+namespace {
+
+/**
+ * return whether the line segment from a to b touches the box spanned by (x1, y1) and (x2, y2)
+ */
+bool segmentTouchesBox(const Coord& a, const Coord& b, double x1, double y1, double x2, double y2)
+{
+    if (std::max(a.x, b.x) < x1 || std::min(a.x, b.x) > x2) return false;
+    if (std::max(a.y, b.y) < y1 || std::min(a.y, b.y) > y2) return false;
+
+    // the segment misses the box if all of its corners lie strictly on the same side of the line
+    double dx = b.x - a.x;
+    double dy = b.y - a.y;
+    auto side = [&](double x, double y) {
+        return dx * (y - a.y) - dy * (x - a.x);
+    };
+    double s[] = {side(x1, y1), side(x2, y1), side(x2, y2), side(x1, y2)};
+    if (std::all_of(std::begin(s), std::end(s), [](double v) { return v > 0; })) return false;
+    if (std::all_of(std::begin(s), std::end(s), [](double v) { return v < 0; })) return false;
+
+    return true;
+}
+
+/**
+ * number of frequencies attenuateByVehicles processes at once, accumulating their attenuation (in dB) on the stack
+ */
+constexpr size_t knifeEdgeChunkSize = 64;
+
+/**
+ * add the attenuation (in dB) due to obstacle ob on the line of sight from tx to rx (see getVehicleAttenuationSingle) to att
+ */
+void addKnifeEdgeAttenuation(const std::pair<double, double>& tx, const std::pair<double, double>& ob, const std::pair<double, double>& rx, const double* invSqrtWavelengths, double* att, size_t numValues)
+{
+    double d = rx.first - tx.first;
+    double d1 = ob.first - tx.first;
+    double d2 = d - d1;
+    double y = (rx.second - tx.second) / d * d1 + tx.second;
+    double H = ob.second - y;
+
+    // V0 = sqrt(2) * H / sqrt(lambda * d1 * d2 / d), split into a geometric and a per-frequency factor
+    double g = sqrt(2) * H / sqrt(d1 * d2 / d);
+    for (size_t i = 0; i < numValues; i++) {
+        double V0 = g * invSqrtWavelengths[i];
+        if (V0 > -0.7) {
+            att[i] += 6.9 + 20 * log10(sqrt((V0 - 0.1) * (V0 - 0.1) + 1) + V0 - 0.1);
+        }
+    }
+}
+
+/**
+ * return the next "major obstacle" after index i (see getVehicleAttenuationDZ), i.e., the one with the steepest slope as seen from i
+ */
+size_t nextMajorObstacle(const std::vector<std::pair<double, double>>& dz_vec, size_t i)
+{
+    double max_slope = -std::numeric_limits<double>::infinity();
+    size_t max_slope_index = dz_vec.size() - 1;
+    for (size_t j = i + 1; j < dz_vec.size(); ++j) {
+        double slope = (dz_vec[j].second - dz_vec[i].second) / (dz_vec[j].first - dz_vec[i].first);
+        if (slope > max_slope) {
+            max_slope = slope;
+            max_slope_index = j;
+        }
+    }
+    return max_slope_index;
+}
+
+} // namespace
+
+VehicleObstacleControl::~VehicleObstacleControl()
+{
+    getSystemModule()->unsubscribe(BaseMobility::mobilityStateChangedSignal, this);
+}
 
 void VehicleObstacleControl::initialize(int stage)
 {
+    if (stage == 0) {
+        gridCellSize = par("gridCellSize");
+        if (gridCellSize <= 0) {
+            throw cRuntimeError("gridCellSize was %f, but must be positive", gridCellSize);
+        }
+
+        // any host changing its move invalidates the footprints
+        getSystemModule()->subscribe(BaseMobility::mobilityStateChangedSignal, this);
+    }
     if (stage == 1) {
         annotations = AnnotationManagerAccess().getIfExists();
         if (annotations) {
@@ -68,29 +154,129 @@ void VehicleObstacleControl::handleSelfMsg(cMessage* msg)
     throw cRuntimeError("VehicleObstacleControl doesn't handle self-messages");
 }
 
+void VehicleObstacleControl::receiveSignal(cComponent* source, simsignal_t signalID, cObject* obj, cObject* details)
+{
+    if (signalID == BaseMobility::mobilityStateChangedSignal) {
+        footprintsDirty = true;
+    }
+}
+
 const MobileHostObstacle* VehicleObstacleControl::add(MobileHostObstacle obstacle)
 {
     auto* o = new MobileHostObstacle(obstacle);
-    vehicleObstacles.push_back(o);
+    vehicleObstacleIndex[o] = vehicleObstacles.size();
+    vehicleObstacles.emplace_back(o);
+    footprintsDirty = true;
 
     return o;
 }
 
 void VehicleObstacleControl::erase(const MobileHostObstacle* obstacle)
 {
-    bool erasedOne = false;
-    for (auto k = vehicleObstacles.begin(); k != vehicleObstacles.end();) {
-        MobileHostObstacle* o = *k;
-        if (o == obstacle) {
-            erasedOne = true;
-            k = vehicleObstacles.erase(k);
+    auto k = vehicleObstacleIndex.find(obstacle);
+    ASSERT(k != vehicleObstacleIndex.end());
+
+    // move the last obstacle into the freed slot
+    size_t i = k->second;
+    vehicleObstacleIndex.erase(k);
+    if (i != vehicleObstacles.size() - 1) {
+        vehicleObstacles[i] = std::move(vehicleObstacles.back());
+        vehicleObstacleIndex[vehicleObstacles[i].get()] = i;
+    }
+    vehicleObstacles.pop_back();
+    footprintsDirty = true;
+}
+
+const VehicleObstacleControl::FootprintGrid& VehicleObstacleControl::getFootprintGrid() const
+{
+    std::lock_guard<std::mutex> lock(footprintMutex);
+    if (footprintsDirty) {
+        rebuildFootprintGrid();
+        footprintsDirty = false;
+    }
+    return footprintGrid;
+}
+
+void VehicleObstacleControl::rebuildFootprintGrid() const
+{
+    FootprintGrid& grid = footprintGrid;
+    grid.time = simTime();
+    grid.maxSpeed = 0;
+    grid.footprints.clear();
+    grid.footprints.reserve(vehicleObstacles.size());
+
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = std::numeric_limits<double>::infinity();
+    double maxX = -std::numeric_limits<double>::infinity();
+    double maxY = -std::numeric_limits<double>::infinity();
+    for (const auto& o : vehicleObstacles) {
+        const BaseMobility* m = o->getMobility();
+        Coord p = m->getPositionAt(grid.time);
+
+        Footprint f;
+        f.obstacle = o.get();
+        f.shapeOffsets = o->getShapeOffsets();
+        f.minX = f.minY = std::numeric_limits<double>::infinity();
+        f.maxX = f.maxY = -std::numeric_limits<double>::infinity();
+        for (const auto& c : f.shapeOffsets) {
+            f.minX = std::min(f.minX, p.x + c.x);
+            f.minY = std::min(f.minY, p.y + c.y);
+            f.maxX = std::max(f.maxX, p.x + c.x);
+            f.maxY = std::max(f.maxY, p.y + c.y);
         }
-        else {
-            ++k;
+        minX = std::min(minX, f.minX);
+        minY = std::min(minY, f.minY);
+        maxX = std::max(maxX, f.maxX);
+        maxY = std::max(maxY, f.maxY);
+        grid.maxSpeed = std::max(grid.maxSpeed, m->getCurrentSpeed().length());
+        grid.footprints.push_back(std::move(f));
+    }
+
+    grid.cellStart.clear();
+    grid.cellEntries.clear();
+    if (grid.footprints.empty()) {
+        grid.cellsX = grid.cellsY = 0;
+        return;
+    }
+
+    grid.originX = minX;
+    grid.originY = minY;
+    grid.cellsX = static_cast<size_t>((maxX - minX) / gridCellSize) + 1;
+    grid.cellsY = static_cast<size_t>((maxY - minY) / gridCellSize) + 1;
+
+    // cells covered by each footprint, as (first x, first y, last x, last y)
+    std::vector<std::array<size_t, 4>> covered;
+    covered.reserve(grid.footprints.size());
+    for (const auto& f : grid.footprints) {
+        size_t cx1 = static_cast<size_t>((f.minX - grid.originX) / gridCellSize);
+        size_t cy1 = static_cast<size_t>((f.minY - grid.originY) / gridCellSize);
+        size_t cx2 = std::min(static_cast<size_t>((f.maxX - grid.originX) / gridCellSize), grid.cellsX - 1);
+        size_t cy2 = std::min(static_cast<size_t>((f.maxY - grid.originY) / gridCellSize), grid.cellsY - 1);
+        covered.push_back({{cx1, cy1, cx2, cy2}});
+    }
+
+    // counting sort of footprints into cells
+    grid.cellStart.assign(grid.cellsX * grid.cellsY + 1, 0);
+    for (const auto& c : covered) {
+        for (size_t cy = c[1]; cy <= c[3]; ++cy) {
+            for (size_t cx = c[0]; cx <= c[2]; ++cx) {
+                ++grid.cellStart[cy * grid.cellsX + cx + 1];
+            }
+        }
+    }
+    for (size_t cell = 0; cell < grid.cellsX * grid.cellsY; ++cell) {
+        grid.cellStart[cell + 1] += grid.cellStart[cell];
+    }
+    grid.cellEntries.resize(grid.cellStart.back());
+    std::vector<size_t> fill(grid.cellStart.begin(), grid.cellStart.end() - 1);
+    for (size_t i = 0; i < covered.size(); ++i) {
+        const auto& c = covered[i];
+        for (size_t cy = c[1]; cy <= c[3]; ++cy) {
+            for (size_t cx = c[0]; cx <= c[2]; ++cx) {
+                grid.cellEntries[fill[cy * grid.cellsX + cx]++] = i;
+            }
         }
     }
-    ASSERT(erasedOne);
-    delete obstacle;
 }
 
 Signal VehicleObstacleControl::getVehicleAttenuationSingle(double h1, double h2, double h, double d, double d1, Signal attenuationPrototype)
@@ -273,10 +459,104 @@ Signal VehicleObstacleControl::getVehicleAttenuationDZ(const std::vector<std::pa
     return attenuation_mo + attenuation_so + c;
 }
 
-std::vector<std::pair<double, double>> VehicleObstacleControl::getPotentialObstacles(const AntennaPosition& senderPos_, const AntennaPosition& receiverPos_, const Signal& s) const
+std::vector<double> VehicleObstacleControl::getInvSqrtWavelengths(const Spectrum& spectrum)
+{
+    std::vector<double> invSqrtWavelengths(spectrum.getNumFreqs());
+    for (size_t i = 0; i < spectrum.getNumFreqs(); i++) {
+        double lambda = BaseWorldUtility::speedOfLight() / spectrum.freqAt(i);
+        invSqrtWavelengths[i] = 1 / sqrt(lambda);
+    }
+    return invSqrtWavelengths;
+}
+
+void VehicleObstacleControl::attenuateByVehicles(const std::vector<std::pair<double, double>>& dz_vec, const std::vector<double>& invSqrtWavelengths, double* values)
+{
+    ASSERT(dz_vec.size() >= 2);
+
+    const size_t last = dz_vec.size() - 1;
+
+    for (size_t offset = 0; offset < invSqrtWavelengths.size(); offset += knifeEdgeChunkSize) {
+        const size_t numValues = std::min(knifeEdgeChunkSize, invSqrtWavelengths.size() - offset);
+        const double* inv = invSqrtWavelengths.data() + offset;
+        double att[knifeEdgeChunkSize] = {};
+
+        // terms of the correction for multiple knife edges
+        double prodS = 1;
+        double sumS = 0;
+        double prodSsum = 1;
+        double firstS = 0;
+        double lastS = 0;
+
+        // walk the major obstacles (MOs) from sender to receiver, looking at each pair (a, b) and each triple (prev, a, b) of consecutive MOs once
+        size_t prev = 0;
+        size_t a = 0;
+        bool havePrev = false;
+        while (a != last) {
+            size_t b = nextMajorObstacle(dz_vec, a);
+
+            // MO a, between MOs prev and b
+            if (havePrev) {
+                addKnifeEdgeAttenuation(dz_vec[prev], dz_vec[a], dz_vec[b], inv, att, numValues);
+            }
+
+            // "small obstacle" in-between MOs a and b: the one closest to their line of sight
+            if (b - a >= 2) {
+                double x1 = dz_vec[a].first;
+                double y1 = dz_vec[a].second;
+                double x2 = dz_vec[b].first;
+                double y2 = dz_vec[b].second;
+
+                double min_delta_h = std::numeric_limits<float>::infinity();
+                size_t ob = a + 1;
+                for (size_t j = a + 1; j < b; ++j) {
+                    double h = (y2 - y1) / (x2 - x1) * (dz_vec[j].first - x1) + y1;
+                    double delta_h = h - dz_vec[j].second;
+                    if (delta_h < min_delta_h) {
+                        min_delta_h = delta_h;
+                        ob = j;
+                    }
+                }
+                addKnifeEdgeAttenuation(dz_vec[a], dz_vec[ob], dz_vec[b], inv, att, numValues);
+            }
+
+            double s = dz_vec[b].first - dz_vec[a].first; ///< distance between two MOs
+            prodS *= s;
+            sumS += s;
+            if (havePrev) {
+                prodSsum *= (s + lastS);
+            }
+            else {
+                firstS = s;
+            }
+            lastS = s;
+
+            prev = a;
+            a = b;
+            havePrev = true;
+        }
+
+        double c = -10 * log10((prodS * sumS) / (prodSsum * firstS * lastS));
+
+        // convert from "dB loss" to a multiplicative factor
+        for (size_t i = 0; i < numValues; i++) {
+            values[offset + i] *= pow(10.0, -(att[i] + c) / 10.0);
+        }
+    }
+}
+
+std::vector<std::pair<double, double>> VehicleObstacleControl::getPotentialObstacles(const AntennaPosition& senderPos, const AntennaPosition& receiverPos, const Signal& s) const
 {
+    // worker threads must not switch the simulation's context (nor draw annotations)
+    if (ThreadPool::isInParallelSection()) {
+        return findPotentialObstacles(senderPos, receiverPos, s, false);
+    }
+
     Enter_Method_Silent();
+    return findPotentialObstacles(senderPos, receiverPos, s, hasGUI() && annotations);
+}
 
+std::vector<std::pair<double, double>> VehicleObstacleControl::findPotentialObstacles(const AntennaPosition& senderPos_, const AntennaPosition& receiverPos_, const Signal& s, bool draw) const
+{
     auto senderPos = senderPos_.getPositionAt();
     auto receiverPos = receiverPos_.getPositionAt();
 
@@ -292,28 +572,53 @@ std::vector<std::pair<double, double>> VehicleObstacleControl::getPotentialObsta
 
     EV << "searching candidates for transmission from " << senderPos.info() << " -> " << receiverPos.info() << " (" << senderPos.distance(receiverPos) << "meters total)" << std::endl;
 
-    if (hasGUI() && annotations) {
+    if (draw) {
         annotations->eraseAll(vehicleAnnotationGroup);
         drawVehicleObstacles(sStart);
         annotations->drawLine(senderPos, receiverPos, "blue", vehicleAnnotationGroup);
     }
 
-    double x1 = std::min(senderPos.x, receiverPos.x);
-    double x2 = std::max(senderPos.x, receiverPos.x);
-    double y1 = std::min(senderPos.y, receiverPos.y);
-    double y2 = std::max(senderPos.y, receiverPos.y);
+    const FootprintGrid& grid = getFootprintGrid();
+
+    // hosts may have moved since the footprints were taken, so widen the search accordingly
+    double margin = grid.maxSpeed * std::abs(SIMTIME_DBL(sStart - grid.time));
+
+    double x1 = std::min(senderPos.x, receiverPos.x) - margin;
+    double x2 = std::max(senderPos.x, receiverPos.x) + margin;
+    double y1 = std::min(senderPos.y, receiverPos.y) - margin;
+    double y2 = std::max(senderPos.y, receiverPos.y) + margin;
+
+    // collect footprints in grid cells touched by the line of sight
+    std::vector<size_t> candidates;
+    if (grid.cellsX > 0 && x2 >= grid.originX && y2 >= grid.originY) {
+        size_t cx1 = static_cast<size_t>(std::max(0.0, (x1 - grid.originX) / gridCellSize));
+        size_t cy1 = static_cast<size_t>(std::max(0.0, (y1 - grid.originY) / gridCellSize));
+        size_t cx2 = static_cast<size_t>(std::min<double>(grid.cellsX - 1, (x2 - grid.originX) / gridCellSize));
+        size_t cy2 = static_cast<size_t>(std::min<double>(grid.cellsY - 1, (y2 - grid.originY) / gridCellSize));
+        for (size_t cy = cy1; cy <= cy2; ++cy) {
+            for (size_t cx = cx1; cx <= cx2; ++cx) {
+                double cellX = grid.originX + cx * gridCellSize;
+                double cellY = grid.originY + cy * gridCellSize;
+                if (!segmentTouchesBox(senderPos, receiverPos, cellX - margin, cellY - margin, cellX + gridCellSize + margin, cellY + gridCellSize + margin)) continue;
+                size_t cell = cy * grid.cellsX + cx;
+                candidates.insert(candidates.end(), grid.cellEntries.begin() + grid.cellStart[cell], grid.cellEntries.begin() + grid.cellStart[cell + 1]);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
 
-    for (auto o : vehicleObstacles) {
+    for (size_t candidate : candidates) {
+        const Footprint& f = grid.footprints[candidate];
+        const MobileHostObstacle* o = f.obstacle;
         auto obstacleAntennaPositions = o->getInitialAntennaPositions();
         double l = o->getLength();
         double w = o->getWidth();
         double h = o->getHeight();
 
-        auto hp_approx = o->getMobility()->getPositionAt(simTime());
+        EV << "checking vehicle in proximity of " << Coord((f.minX + f.maxX) / 2, (f.minY + f.maxY) / 2).info() << " with height: " << h << " width: " << w << " length: " << l << endl;
 
-        EV << "checking vehicle in proximity of " << hp_approx.info() << " with height: " << h << " width: " << w << " length: " << l << endl;
-
-        if (!o->maybeInBounds(x1, y1, x2, y2, sStart)) {
+        if (!segmentTouchesBox(senderPos, receiverPos, f.minX - margin, f.minY - margin, f.maxX + margin, f.maxY + margin)) {
             EV_TRACE << "bounding boxes don't overlap: ignore" << std::endl;
             continue;
         }
@@ -333,7 +638,12 @@ std::vector<std::pair<double, double>> VehicleObstacleControl::getPotentialObsta
         if (ignoreMe) continue;
 
         // this is a potential obstacle
-        double p1d = o->getIntersectionPoint(senderPos, receiverPos, sStart);
+        MobileHostObstacle::Coords shape = f.shapeOffsets;
+        Coord hostPos = o->getMobility()->getPositionAt(sStart);
+        for (auto& c : shape) {
+            c = hostPos + c;
+        }
+        double p1d = MobileHostObstacle::getIntersectionPoint(shape, senderPos, receiverPos);
         double maxd = senderPos.distance(receiverPos);
         if (!std::isnan(p1d) && p1d > 0 && p1d < maxd) {
             auto it = potentialObstacles.begin();
@@ -354,7 +664,7 @@ std::vector<std::pair<double, double>> VehicleObstacleControl::getPotentialObsta
             }
             EV << "\tgot obstacle in 2d-LOS, " << p1d << " meters away from sender" << std::endl;
             Coord hitPos = senderPos + (receiverPos - senderPos) / senderPos.distance(receiverPos) * p1d;
-            if (hasGUI() && annotations) {
+            if (draw) {
                 annotations->drawLine(senderPos, hitPos, "red", vehicleAnnotationGroup);
             }
         }
@@ -365,7 +675,7 @@ std::vector<std::pair<double, double>> VehicleObstacleControl::getPotentialObsta
 
 void VehicleObstacleControl::drawVehicleObstacles(const simtime_t& t) const
 {
-    for (auto o : vehicleObstacles) {
+    for (const auto& o : vehicleObstacles) {
         annotations->drawPolygon(o->getShape(t), "black", vehicleAnnotationGroup);
     }
 }
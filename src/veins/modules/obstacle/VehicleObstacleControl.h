@@ -22,7 +22,10 @@
 
 #pragma once
 
-#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "veins/veins.h"
 
@@ -36,6 +39,7 @@
 namespace veins {
 
 class Signal;
+class Spectrum;
 
 /**
  * VehicleObstacleControl models moving obstacles that block radio transmissions.
@@ -43,8 +47,12 @@ class Signal;
  * Each Obstacle is a polygon.
  * Transmissions that cross one of the polygon's lines will have
  * their receive power set to zero.
+ *
+ * Footprints of all vehicles are kept in a uniform grid of gridCellSize tiles.
+ * The grid is rebuilt lazily on the first query after any host's move changed (i.e., about once per TraCI step),
+ * so each query only tests the vehicles close to the line of sight.
  */
-class VEINS_API VehicleObstacleControl : public cSimpleModule {
+class VEINS_API VehicleObstacleControl : public cSimpleModule, protected cListener {
 public:
     ~VehicleObstacleControl() override;
     void initialize(int stage) override;
@@ -55,12 +63,15 @@ public:
     void finish() override;
     void handleMessage(cMessage* msg) override;
     void handleSelfMsg(cMessage* msg);
+    void receiveSignal(cComponent* source, simsignal_t signalID, cObject* obj, cObject* details) override;
 
     const MobileHostObstacle* add(MobileHostObstacle obstacle);
     void erase(const MobileHostObstacle* obstacle);
 
     /**
      * get distance and height of potential obstacles
+     *
+     * may be called from several threads at once (see ThreadPool); annotations are not drawn then
      */
     std::vector<std::pair<double, double>> getPotentialObstacles(const AntennaPosition& senderPos, const AntennaPosition& receiverPos, const Signal& s) const;
 
@@ -88,13 +99,74 @@ public:
      */
     static Signal getVehicleAttenuationDZ(const std::vector<std::pair<double, double>>& dz_vec, Signal attenuationPrototype);
 
+    /**
+     * return 1 / sqrt(lambda) for each frequency of spectrum, as needed by attenuateByVehicles
+     */
+    static std::vector<double> getInvSqrtWavelengths(const Spectrum& spectrum);
+
+    /**
+     * multiply values (one per frequency) by the attenuation due to vehicles, in place.
+     *
+     * Computes the same attenuation as getVehicleAttenuationDZ (converted from dB to a factor),
+     * but in a single pass over dz_vec and without allocating memory.
+     *
+     * @param dz_vec: a vector of (distance, height) referring to potential obstacles along the line of sight, starting with the sender and ending with the receiver
+     * @param invSqrtWavelengths: 1 / sqrt(lambda) for each frequency (see getInvSqrtWavelengths)
+     * @param values: one linear power value per frequency, attenuated in place
+     */
+    static void attenuateByVehicles(const std::vector<std::pair<double, double>>& dz_vec, const std::vector<double>& invSqrtWavelengths, double* values);
+
 protected:
+    /**
+     * Footprint of a vehicle, valid for as long as the move of its host does not change.
+     */
+    struct Footprint {
+        const MobileHostObstacle* obstacle;
+        MobileHostObstacle::Coords shapeOffsets; /**< corners relative to the host position (see MobileHostObstacle::getShapeOffsets) */
+        double minX; /**< bounding box at FootprintGrid::time */
+        double minY;
+        double maxX;
+        double maxY;
+    };
+
+    /**
+     * Footprints of all vehicles as of one point in time, sorted into a uniform grid.
+     */
+    struct FootprintGrid {
+        simtime_t time; /**< time the footprints were taken at */
+        double maxSpeed = 0; /**< speed of the fastest vehicle, bounding how far footprints drift from their bounding box */
+        std::vector<Footprint> footprints;
+        double originX = 0;
+        double originY = 0;
+        size_t cellsX = 0;
+        size_t cellsY = 0;
+        std::vector<size_t> cellStart; /**< per cell (row-major, plus one past the end): index of its first entry in cellEntries */
+        std::vector<size_t> cellEntries; /**< indices into footprints, grouped by cell */
+    };
+
     AnnotationManager* annotations;
 
-    using VehicleObstacles = std::list<MobileHostObstacle*>;
+    using VehicleObstacles = std::vector<std::unique_ptr<MobileHostObstacle>>;
     VehicleObstacles vehicleObstacles;
+    std::unordered_map<const MobileHostObstacle*, size_t> vehicleObstacleIndex; /**< position of each obstacle in vehicleObstacles */
     AnnotationManager::Group* vehicleAnnotationGroup;
     void drawVehicleObstacles(const simtime_t& t) const;
+
+    double gridCellSize;
+    mutable std::mutex footprintMutex; /**< guards footprintGrid and footprintsDirty during concurrent calls of getPotentialObstacles */
+    mutable FootprintGrid footprintGrid;
+    mutable bool footprintsDirty = true; /**< whether a vehicle was added, erased, or changed its move since footprintGrid was built */
+
+    /**
+     * return footprintGrid, rebuilding it first if it is outdated
+     */
+    const FootprintGrid& getFootprintGrid() const;
+    void rebuildFootprintGrid() const;
+
+    /**
+     * getPotentialObstacles without switching the simulation's context, optionally drawing annotations
+     */
+    std::vector<std::pair<double, double>> findPotentialObstacles(const AntennaPosition& senderPos, const AntennaPosition& receiverPos, const Signal& s, bool draw) const;
 };
 
 class VEINS_API VehicleObstacleControlAccess {
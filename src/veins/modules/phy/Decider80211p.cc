@@ -27,6 +27,8 @@
  * and modifications by Christopher Saloman
  */
 
+#include <algorithm>
+
 #include "veins/modules/phy/Decider80211p.h"
 #include "veins/modules/phy/DeciderResult80211.h"
 #include "veins/modules/messages/Mac80211Pkt_m.h"
@@ -36,9 +38,25 @@
 #include "veins/modules/utility/ConstsPhy.h"
 
 #include "veins/base/toolbox/SignalUtils.h"
+#include "veins/base/modules/BaseWorldUtility.h"
 
 using namespace veins;
 
+namespace {
+
+/**
+ * Deciders synced to a frame, by the time the reception of this frame ends.
+ *
+ * Shared by all deciders of the simulation, see Decider80211p::evaluateReceptionsEndingNow().
+ */
+std::map<simtime_t, std::vector<Decider80211p*>>& receptionsByEnd()
+{
+    static std::map<simtime_t, std::vector<Decider80211p*>> receptions;
+    return receptions;
+}
+
+} // namespace
+
 simtime_t Decider80211p::processNewSignal(AirFrame* msg)
 {
 
@@ -49,6 +67,12 @@ simtime_t Decider80211p::processNewSignal(AirFrame* msg)
 
     signalStates[frame] = EXPECT_END;
 
+    if (parallelDecisions && !signal.hasRandomStream()) {
+        // analogue models might be applied on another thread, so they must not draw from the RNG of the context module
+        // (the complemented seed keeps this stream apart from the one used for decoding)
+        signal.setRandomStreamKey(CounterRng::combine(~randomStreamSeed, frame->getId()));
+    }
+
     if (signal.smallerAtCenterFrequency(minPowerLevel)) {
 
         // annotate the frame, so that we won't try decoding it at its end
@@ -75,6 +99,9 @@ simtime_t Decider80211p::processNewSignal(AirFrame* msg)
             if (!currentSignal.first) {
                 // NIC is not yet synced to any frame, so lock and try to decode this frame
                 currentSignal.first = frame;
+                if (parallelDecisions) {
+                    registerReception(signal.getReceptionEnd());
+                }
                 EV_TRACE << "AirFrame: " << frame->getId() << " with (" << recvPower << " > " << minPowerLevel << ") -> Trying to receive AirFrame." << std::endl;
                 if (notifyRxStart) {
                     phy->sendControlMsgToMac(new cMessage("RxStartStatus", MacToPhyInterface::PHY_RX_START));
@@ -114,32 +141,26 @@ DeciderResult* Decider80211p::checkIfSignalOk(AirFrame* frame)
 
     start = start + PHY_HDR_PREAMBLE_DURATION; // its ok if something in the training phase is broken
 
-    AirFrameVector airFrames;
-    getChannelInfo(start, end, airFrames);
-
-    double noise = phy->getNoiseFloorValue();
+    // distant transmitters are not represented by AirFrames, but add to the noise
+    double farFieldInterference = phy11p->getFarFieldInterference(start, end, centerFrequency);
 
-    // Make sure to use the adjusted starting-point (which ignores the preamble)
-    double sinrMin = SignalUtils::getMinSINR(start, end, frame, airFrames, noise);
-    double snrMin;
-    if (collectCollisionStats) {
-        // snrMin = SignalUtils::getMinSNR(start, end, frame, noise);
-        snrMin = s.getDataMin() / noise;
-    }
-    else {
-        // just set to any value. if collectCollisionStats != true
-        // it will be ignored by packetOk
-        snrMin = 1e200;
+    // reuse the evaluation computed by evaluateReceptionsEndingNow(), unless the far field has changed since
+    if (evaluatedFrame != frame || evaluation.farFieldInterference != farFieldInterference) {
+        AirFrameVector airFrames;
+        getChannelInfo(start, end, airFrames);
+        evaluation = evaluateSignal(frame11p, airFrames, farFieldInterference);
     }
+    evaluatedFrame = nullptr;
 
-    double payloadBitrate = getOfdmDatarate(static_cast<MCS>(frame11p->getMcs()), BANDWIDTH_11P);
+    double sinrMin = evaluation.sinrMin;
+    double payloadBitrate = evaluation.payloadBitrate;
 
     DeciderResult80211* result = nullptr;
 
     // compute receive power
     double recvPower_dBm = 10 * log10(s.getAtCenterFrequency());
 
-    switch (packetOk(sinrMin, snrMin, frame->getBitLength(), payloadBitrate)) {
+    switch (evaluation.result) {
 
     case DECODED:
         EV_TRACE << "Packet is fine! We can decode it" << std::endl;
@@ -170,7 +191,141 @@ DeciderResult* Decider80211p::checkIfSignalOk(AirFrame* frame)
     return result;
 }
 
-enum Decider80211p::PACKET_OK_RESULT Decider80211p::packetOk(double sinrMin, double snrMin, int lengthMPDU, double bitrate)
+Decider80211p::SignalEvaluation Decider80211p::evaluateSignal(AirFrame* frame, AirFrameVector& airFrames, double farFieldInterference)
+{
+    auto frame11p = check_and_cast<AirFrame11p*>(frame);
+
+    Signal& s = frame->getSignal();
+    simtime_t start = s.getReceptionStart() + PHY_HDR_PREAMBLE_DURATION;
+    simtime_t end = s.getReceptionEnd();
+
+    double noise = phy->getNoiseFloorValue();
+
+    SignalEvaluation eval;
+    eval.farFieldInterference = farFieldInterference;
+
+    // Make sure to use the adjusted starting-point (which ignores the preamble)
+    eval.sinrMin = SignalUtils::getMinSINR(start, end, frame, airFrames, noise + farFieldInterference);
+    double snrMin;
+    if (collectCollisionStats) {
+        // snrMin = SignalUtils::getMinSNR(start, end, frame, noise);
+        snrMin = s.getDataMin() / noise;
+    }
+    else {
+        // just set to any value. if collectCollisionStats != true
+        // it will be ignored by packetOk
+        snrMin = 1e200;
+    }
+
+    eval.payloadBitrate = getOfdmDatarate(static_cast<MCS>(frame11p->getMcs()), BANDWIDTH_11P);
+
+    if (parallelDecisions) {
+        // the outcome must not depend on which decider evaluates the frame, or in which order
+        CounterRng randomStream(CounterRng::combine(randomStreamSeed, frame->getId()));
+        eval.result = packetOk(eval.sinrMin, snrMin, frame->getBitLength(), eval.payloadBitrate, &randomStream);
+    }
+    else {
+        eval.result = packetOk(eval.sinrMin, snrMin, frame->getBitLength(), eval.payloadBitrate);
+    }
+
+    return eval;
+}
+
+bool Decider80211p::prepareConcurrentFiltering(AirFrame* frame, AirFrameVector& airFrames)
+{
+    auto prepare = [](AirFrame* airFrame) {
+        Signal& signal = airFrame->getSignal();
+        AnalogueModelList* models = signal.getAnalogueModelList();
+        if (!models) return true;
+        for (size_t i = signal.getNumAnalogueModelsApplied(); i < models->size(); ++i) {
+            if (!(*models)[i]->isThreadSafe()) return false;
+            (*models)[i]->prepareConcurrentFiltering(signal);
+        }
+        return true;
+    };
+
+    if (!prepare(frame)) return false;
+    for (auto interferer : airFrames) {
+        if (!prepare(interferer)) return false;
+    }
+    return true;
+}
+
+void Decider80211p::evaluateReceptionsEndingNow()
+{
+    auto& receptions = receptionsByEnd();
+    simtime_t now = simTime();
+
+    // receptions that were supposed to end earlier are stale
+    receptions.erase(receptions.begin(), receptions.lower_bound(now));
+
+    auto it = receptions.find(now);
+    if (it == receptions.end()) return;
+    std::vector<Decider80211p*> deciders = std::move(it->second);
+    receptions.erase(it);
+
+    struct Candidate {
+        Decider80211p* decider;
+        AirFrame* frame;
+        AirFrameVector airFrames;
+        double farFieldInterference;
+        SignalEvaluation evaluation;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(deciders.size());
+
+    // collect everything that needs the simulation kernel serially
+    for (auto decider : deciders) {
+        decider->registeredEnd = -1;
+        auto frame = dynamic_cast<AirFrame11p*>(decider->currentSignal.first);
+        if (!frame) continue;
+        const Signal& signal = frame->getSignal();
+        if (signal.getReceptionEnd() != now) continue;
+        if (frame->getUnderMinPowerLevel() || frame->getWasTransmitting() || decider->phy11p->getRadioState() == Radio::TX) continue;
+
+        simtime_t start = signal.getReceptionStart() + PHY_HDR_PREAMBLE_DURATION;
+        Candidate candidate{decider, frame, {}, 0, {}};
+        decider->getChannelInfo(start, now, candidate.airFrames);
+        if (!prepareConcurrentFiltering(frame, candidate.airFrames)) continue;
+        candidate.farFieldInterference = decider->phy11p->getFarFieldInterference(start, now, decider->centerFrequency);
+        candidates.push_back(std::move(candidate));
+    }
+
+    // a single reception gains nothing from being evaluated in advance
+    if (candidates.size() < 2) return;
+
+    phy->getWorldUtility()->getThreadPool().parallelFor(candidates.size(), [&candidates](size_t i) {
+        Candidate& candidate = candidates[i];
+        candidate.evaluation = candidate.decider->evaluateSignal(candidate.frame, candidate.airFrames, candidate.farFieldInterference);
+    });
+
+    for (auto& candidate : candidates) {
+        candidate.decider->evaluatedFrame = candidate.frame;
+        candidate.decider->evaluation = candidate.evaluation;
+    }
+}
+
+void Decider80211p::registerReception(simtime_t_cref end)
+{
+    unregisterReception();
+    receptionsByEnd()[end].push_back(this);
+    registeredEnd = end;
+}
+
+void Decider80211p::unregisterReception()
+{
+    if (registeredEnd < SIMTIME_ZERO) return;
+    auto& receptions = receptionsByEnd();
+    auto it = receptions.find(registeredEnd);
+    if (it != receptions.end()) {
+        auto& deciders = it->second;
+        deciders.erase(std::remove(deciders.begin(), deciders.end(), this), deciders.end());
+        if (deciders.empty()) receptions.erase(it);
+    }
+    registeredEnd = -1;
+}
+
+enum Decider80211p::PACKET_OK_RESULT Decider80211p::packetOk(double sinrMin, double snrMin, int lengthMPDU, double bitrate, CounterRng* randomStream)
 {
     double packetOkSinr;
     double packetOkSnr;
@@ -196,7 +351,7 @@ enum Decider80211p::PACKET_OK_RESULT Decider80211p::packetOk(double sinrMin, dou
 
     // probability of no bit error in the PLCP header
 
-    double rand = RNGCONTEXT dblrand();
+    double rand = (randomStream ? randomStream->uniform() : RNGCONTEXT dblrand());
 
     if (!collectCollisionStats) {
         if (rand > headerNoError) return NOT_DECODED;
@@ -219,7 +374,7 @@ enum Decider80211p::PACKET_OK_RESULT Decider80211p::packetOk(double sinrMin, dou
 
     // probability of no bit error in the rest of the packet
 
-    rand = RNGCONTEXT dblrand();
+    rand = (randomStream ? randomStream->uniform() : RNGCONTEXT dblrand());
 
     if (!collectCollisionStats) {
         if (rand > packetOkSinr) {
@@ -299,6 +454,9 @@ simtime_t Decider80211p::processSignalEnd(AirFrame* msg)
 
         // first check whether this is the frame NIC is currently synced on
         if (frame == currentSignal.first) {
+            if (parallelDecisions && registeredEnd == simTime()) {
+                evaluateReceptionsEndingNow();
+            }
             // check if the snr is above the Decider's specific threshold,
             // i.e. the Decider has received it correctly
             result = checkIfSignalOk(frame);
@@ -306,6 +464,7 @@ simtime_t Decider80211p::processSignalEnd(AirFrame* msg)
             // after having tried to decode the frame, the NIC is no more synced to the frame
             // and it is ready for syncing on a new one
             currentSignal.first = 0;
+            unregisterReception();
         }
         else {
             // if this is not the frame we are synced on, we cannot receive it
@@ -345,6 +504,10 @@ simtime_t Decider80211p::processSignalEnd(AirFrame* msg)
         delete result;
     }
 
+    if (evaluatedFrame == frame) {
+        evaluatedFrame = nullptr;
+    }
+
     if (phy11p->getRadioState() == Radio::TX) {
         EV_TRACE << "I'm currently sending\n";
     }
@@ -406,6 +569,8 @@ void Decider80211p::switchToTx()
             currentFrame->setBitError(true);
             // forget about the signal
             currentSignal.first = 0;
+            unregisterReception();
+            evaluatedFrame = nullptr;
         }
         else {
             throw cRuntimeError("Decider80211p: mac layer requested phy to transmit a frame while currently receiving another");
@@ -422,4 +587,7 @@ void Decider80211p::finish()
     }
 }
 
-Decider80211p::~Decider80211p(){};
+Decider80211p::~Decider80211p()
+{
+    unregisterReception();
+};
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "veins/base/phyLayer/BaseDecider.h"
+#include "veins/base/utils/CounterRng.h"
 #include "veins/modules/utility/Consts80211p.h"
 #include "veins/modules/mac/ieee80211p/Mac80211pToPhy11pInterface.h"
 #include "veins/modules/phy/Decider80211pToPhy80211pInterface.h"
@@ -122,6 +123,38 @@ protected:
     /** @brief notify PHY-RXSTART.indication  */
     bool notifyRxStart;
 
+    /** @brief Outcome of an attempt to decode a frame, see evaluateSignal() */
+    struct SignalEvaluation {
+        double sinrMin;
+        double payloadBitrate;
+        double farFieldInterference; ///< far-field interference (in mW) the evaluation is based on
+        PACKET_OK_RESULT result;
+    };
+
+    /** @brief enable/disable evaluating receptions that end at the same time in parallel
+     *
+     * Decoding a frame only reads state shared with other deciders.
+     * If enabled, the first decider to reach the end of a reception at
+     * time t also evaluates the receptions of all other deciders ending
+     * at t, on the threads of the world utility module. Each decider then
+     * delivers its result to the MAC in the original event order. Random
+     * numbers are drawn from per-frame streams, so results do not depend
+     * on the number of threads or on which decider evaluated them.
+     */
+    bool parallelDecisions;
+
+    /** @brief key of the per-frame random streams used if parallelDecisions is set, combined with the AirFrame id */
+    uint64_t randomStreamSeed;
+
+    /** @brief the frame evaluation has been computed for in advance (or nullptr) */
+    AirFrame* evaluatedFrame = nullptr;
+
+    /** @brief evaluation of evaluatedFrame */
+    SignalEvaluation evaluation;
+
+    /** @brief end of the reception this decider is registered for to be evaluated in parallel (or -1) */
+    simtime_t registeredEnd = -1;
+
 protected:
     /**
      * @brief Checks a mapping against a specific threshold (element-wise).
@@ -146,15 +179,45 @@ protected:
      */
     simtime_t processSignalEnd(AirFrame* frame) override;
 
-    /** @brief computes if packet is ok or has errors*/
-    enum PACKET_OK_RESULT packetOk(double snirMin, double snrMin, int lengthMPDU, double bitrate);
+    /** @brief computes if packet is ok or has errors
+     *
+     * Random numbers are drawn from randomStream if given, and from the context module's RNG otherwise.
+     */
+    enum PACKET_OK_RESULT packetOk(double snirMin, double snrMin, int lengthMPDU, double bitrate, CounterRng* randomStream = nullptr);
+
+    /**
+     * @brief Computes SINR and outcome of decoding the given frame, interfered by the given AirFrames.
+     *
+     * Only reads state of this decider, so it may be called for several deciders concurrently.
+     */
+    SignalEvaluation evaluateSignal(AirFrame* frame, AirFrameVector& airFrames, double farFieldInterference);
+
+    /**
+     * @brief Evaluates the receptions of all deciders synced to a frame ending now in parallel.
+     *
+     * Results are stored in each decider's evaluation and used by checkIfSignalOk().
+     */
+    void evaluateReceptionsEndingNow();
+
+    /**
+     * @brief Prepares the not yet applied (thresholding) AnalogueModels of all given frames for concurrent filtering.
+     *
+     * @return false if one of the models is not thread-safe
+     */
+    static bool prepareConcurrentFiltering(AirFrame* frame, AirFrameVector& airFrames);
+
+    /** @brief Registers this decider to be evaluated in parallel with all other receptions ending at the given time */
+    void registerReception(simtime_t_cref end);
+
+    /** @brief Undoes registerReception(), if necessary */
+    void unregisterReception();
 
 public:
     /**
      * @brief Initializes the Decider with a pointer to its PhyLayer and
      * specific values for threshold and minPowerLevel
      */
-    Decider80211p(cComponent* owner, DeciderToPhyInterface* phy, double minPowerLevel, double ccaThreshold, bool allowTxDuringRx, double centerFrequency, int myIndex = -1, bool collectCollisionStatistics = false)
+    Decider80211p(cComponent* owner, DeciderToPhyInterface* phy, double minPowerLevel, double ccaThreshold, bool allowTxDuringRx, double centerFrequency, int myIndex = -1, bool collectCollisionStatistics = false, bool parallelDecisions = false, uint64_t randomStreamSeed = 0)
         : BaseDecider(owner, phy, minPowerLevel, myIndex)
         , ccaThreshold(ccaThreshold)
         , allowTxDuringRx(allowTxDuringRx)
@@ -164,6 +227,8 @@ public:
         , collectCollisionStats(collectCollisionStatistics)
         , collisions(0)
         , notifyRxStart(false)
+        , parallelDecisions(parallelDecisions)
+        , randomStreamSeed(randomStreamSeed)
     {
         phy11p = dynamic_cast<Decider80211pToPhy80211pInterface*>(phy);
         ASSERT(phy11p);
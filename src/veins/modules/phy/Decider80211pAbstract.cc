@@ -0,0 +1,373 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/phy/Decider80211pAbstract.h"
+
+#include "veins/modules/phy/DeciderResult80211.h"
+#include "veins/modules/messages/AirFrame11pAbstract_m.h"
+#include "veins/modules/utility/ConstsPhy.h"
+
+using namespace veins;
+
+Decider80211pAbstract::Decider80211pAbstract(cComponent* owner, DeciderToPhyInterface* phy, double minPowerLevel, double ccaThreshold, bool allowTxDuringRx, double centerFrequency, std::shared_ptr<const PERTable> perTable, double perTableReferenceLength, int myIndex, bool collectCollisionStatistics)
+    : BaseDecider(owner, phy, minPowerLevel, myIndex)
+    , ccaThreshold(ccaThreshold)
+    , allowTxDuringRx(allowTxDuringRx)
+    , centerFrequency(centerFrequency)
+    , perTable(std::move(perTable))
+    , perTableReferenceLength(perTableReferenceLength)
+    , myBusyTime(0)
+    , myStartTime(simTime().dbl())
+    , collectCollisionStats(collectCollisionStatistics)
+    , collisions(0)
+    , notifyRxStart(false)
+{
+    phy11p = dynamic_cast<Decider80211pToPhy80211pInterface*>(phy);
+    ASSERT(phy11p);
+    ASSERT(this->perTable);
+    ASSERT(perTableReferenceLength > 0);
+}
+
+bool Decider80211pAbstract::isOnChannel(AirFrame11pAbstract* frame) const
+{
+    return frame->getCenterFrequency() == centerFrequency;
+}
+
+void Decider80211pAbstract::updateSyncedInterference()
+{
+    if (!currentSignal.first || simTime() <= syncedPreambleEnd) return;
+
+    // the current level has been present after the preamble, so it counts for the synced frame
+    auto synced = static_cast<AirFrame11pAbstract*>(currentSignal.first);
+    double interference = isOnChannel(synced) ? channelPower - synced->getRecvPower_mW() : channelPower;
+    syncedMaxInterference = std::max(syncedMaxInterference, interference);
+}
+
+void Decider80211pAbstract::addChannelPower(double power_mW)
+{
+    updateSyncedInterference();
+    channelPower += power_mW;
+    numChannelFrames++;
+}
+
+void Decider80211pAbstract::removeChannelPower(double power_mW)
+{
+    ASSERT(numChannelFrames > 0);
+    updateSyncedInterference();
+    numChannelFrames--;
+    // avoid accumulating rounding errors of the running sum
+    channelPower = (numChannelFrames == 0) ? 0 : std::max(0.0, channelPower - power_mW);
+}
+
+void Decider80211pAbstract::recomputeChannelPower()
+{
+    updateSyncedInterference();
+
+    AirFrameVector airFrames;
+    getChannelInfo(simTime(), simTime(), airFrames);
+
+    channelPower = 0;
+    numChannelFrames = 0;
+    for (auto airFrame : airFrames) {
+        auto frame = check_and_cast<AirFrame11pAbstract*>(airFrame);
+        if (getSignalState(frame) == NEW || !isOnChannel(frame)) continue;
+        channelPower += frame->getRecvPower_mW();
+        numChannelFrames++;
+    }
+}
+
+simtime_t Decider80211pAbstract::processNewSignal(AirFrame* msg)
+{
+    AirFrame11pAbstract* frame = check_and_cast<AirFrame11pAbstract*>(msg);
+
+    double recvPower = frame->getRecvPower_mW();
+    simtime_t receptionEnd = simTime() + frame->getDuration();
+
+    signalStates[frame] = EXPECT_END;
+
+    if (!isOnChannel(frame)) {
+        // frames on other channels are neither decoded nor sensed
+        frame->setUnderMinPowerLevel(true);
+        return receptionEnd;
+    }
+
+    addChannelPower(recvPower);
+
+    if (recvPower < minPowerLevel) {
+
+        // annotate the frame, so that we won't try decoding it at its end
+        frame->setUnderMinPowerLevel(true);
+        // check channel busy status. a superposition of low power frames might turn channel status to busy
+        if (cca() == false) {
+            setChannelIdleStatus(false);
+        }
+        return receptionEnd;
+    }
+
+    setChannelIdleStatus(false);
+
+    if (phy11p->getRadioState() == Radio::TX) {
+        frame->setBitError(true);
+        frame->setWasTransmitting(true);
+        EV_TRACE << "AirFrame: " << frame->getId() << " (" << recvPower << ") received, while already sending. Setting BitErrors to true" << std::endl;
+    }
+    else {
+
+        if (!currentSignal.first) {
+            // NIC is not yet synced to any frame, so lock and try to decode this frame
+            currentSignal.first = frame;
+            syncedPreambleEnd = simTime() + PHY_HDR_PREAMBLE_DURATION;
+            syncedMaxInterference = 0;
+            EV_TRACE << "AirFrame: " << frame->getId() << " with (" << recvPower << " > " << minPowerLevel << ") -> Trying to receive AirFrame." << std::endl;
+            if (notifyRxStart) {
+                phy->sendControlMsgToMac(new cMessage("RxStartStatus", MacToPhyInterface::PHY_RX_START));
+            }
+        }
+        else {
+            // NIC is currently trying to decode another frame. this frame will be simply treated as interference
+            EV_TRACE << "AirFrame: " << frame->getId() << " with (" << recvPower << " > " << minPowerLevel << ") -> Already synced to another AirFrame. Treating AirFrame as interference." << std::endl;
+        }
+
+        // channel turned busy
+        // measure communication density
+        myBusyTime += frame->getDuration().dbl();
+    }
+    return receptionEnd;
+}
+
+int Decider80211pAbstract::getSignalState(AirFrame* frame)
+{
+    auto it = signalStates.find(frame);
+    if (it == signalStates.end()) {
+        return NEW;
+    }
+    return it->second;
+}
+
+DeciderResult* Decider80211pAbstract::checkIfSignalOk(AirFrame11pAbstract* frame)
+{
+    // account for the interference present until the end of the frame
+    updateSyncedInterference();
+
+    double noise = phy->getNoiseFloorValue();
+    double recvPower = frame->getRecvPower_mW();
+    // distant transmitters are not represented by AirFrames, but add to the noise
+    double farFieldInterference = phy11p->getFarFieldInterference(syncedPreambleEnd, simTime(), centerFrequency);
+    double sinr = recvPower / (noise + farFieldInterference + syncedMaxInterference);
+    // if collectCollisionStats != true the snr will be ignored by packetOk
+    double snr = collectCollisionStats ? recvPower / noise : 1e200;
+
+    uint64_t datarate = getOfdmDatarate(static_cast<MCS>(frame->getMcs()), BANDWIDTH_11P);
+    double payloadBitrate = static_cast<double>(datarate);
+    double recvPower_dBm = 10 * log10(recvPower);
+
+    switch (packetOk(sinr, snr, frame->getBitLength(), datarate)) {
+
+    case Decider80211p::DECODED:
+        EV_TRACE << "Packet is fine! We can decode it" << std::endl;
+        return new DeciderResult80211(true, payloadBitrate, sinr, recvPower_dBm, false);
+
+    case Decider80211p::NOT_DECODED:
+        EV_TRACE << "Packet has bit Errors. Lost " << std::endl;
+        return new DeciderResult80211(false, payloadBitrate, sinr, recvPower_dBm, false);
+
+    case Decider80211p::COLLISION:
+        EV_TRACE << "Packet has bit Errors due to collision. Lost " << std::endl;
+        collisions++;
+        return new DeciderResult80211(false, payloadBitrate, sinr, recvPower_dBm, true);
+
+    default:
+        throw cRuntimeError("Impossible packet result returned by packetOk(). Check the code.");
+    }
+}
+
+Decider80211p::PACKET_OK_RESULT Decider80211pAbstract::packetOk(double sinr, double snr, int lengthMPDU, uint64_t datarate)
+{
+    // scale the success rate from the reference length of the table to the length of the frame
+    double lengthFactor = lengthMPDU / perTableReferenceLength;
+    double packetOkSinr = pow(1 - perTable->getPER(datarate, 10 * log10(sinr)), lengthFactor);
+
+    double rand = RNGCONTEXT dblrand();
+
+    if (rand <= packetOkSinr) {
+        return Decider80211p::DECODED;
+    }
+    if (!collectCollisionStats) {
+        return Decider80211p::NOT_DECODED;
+    }
+
+    // the probability of correct reception without considering the interference
+    // MUST be greater or equal than when consider it
+    double packetOkSnr = pow(1 - perTable->getPER(datarate, 10 * log10(snr)), lengthFactor);
+    ASSERT(packetOkSnr >= packetOkSinr);
+
+    // ups, we have an error. is that due to interference?
+    return (rand > packetOkSnr) ? Decider80211p::NOT_DECODED : Decider80211p::COLLISION;
+}
+
+bool Decider80211pAbstract::cca()
+{
+    return phy->getNoiseFloorValue() + channelPower < ccaThreshold;
+}
+
+simtime_t Decider80211pAbstract::processSignalEnd(AirFrame* msg)
+{
+    AirFrame11pAbstract* frame = check_and_cast<AirFrame11pAbstract*>(msg);
+
+    double recvPower_dBm = 10 * log10(frame->getRecvPower_mW());
+
+    bool whileSending = false;
+
+    // remove this frame from our current signals
+    signalStates.erase(frame);
+
+    DeciderResult* result;
+
+    if (frame->getUnderMinPowerLevel()) {
+        // this frame was not even detected by the radio card
+        result = new DeciderResult80211(false, 0, 0, recvPower_dBm);
+    }
+    else if (frame->getWasTransmitting() || phy11p->getRadioState() == Radio::TX) {
+        // this frame was received while sending
+        whileSending = true;
+        result = new DeciderResult80211(false, 0, 0, recvPower_dBm);
+    }
+    else if (frame == currentSignal.first) {
+        result = checkIfSignalOk(frame);
+
+        // after having tried to decode the frame, the NIC is no more synced to the frame
+        // and it is ready for syncing on a new one
+        currentSignal.first = 0;
+    }
+    else {
+        // if this is not the frame we are synced on, we cannot receive it
+        result = new DeciderResult80211(false, 0, 0, recvPower_dBm);
+    }
+
+    if (isOnChannel(frame)) {
+        removeChannelPower(frame->getRecvPower_mW());
+    }
+
+    if (result->isSignalCorrect()) {
+        EV_TRACE << "packet was received correctly, it is now handed to upper layer...\n";
+        // go on with processing this AirFrame, send it to the Mac-Layer
+        if (notifyRxStart) {
+            phy->sendControlMsgToMac(new cMessage("RxStartStatus", MacToPhyInterface::PHY_RX_END_WITH_SUCCESS));
+        }
+        phy->sendUp(frame, result);
+    }
+    else {
+        if (frame->getUnderMinPowerLevel()) {
+            EV_TRACE << "packet was not detected by the card. power was under minPowerLevel threshold\n";
+        }
+        else if (whileSending) {
+            EV_TRACE << "packet was received while sending, sending it as control message to upper layer\n";
+            phy->sendControlMsgToMac(new cMessage("Error", Decider80211p::RECWHILESEND));
+        }
+        else {
+            EV_TRACE << "packet was not received correctly, sending it as control message to upper layer\n";
+            if (notifyRxStart) {
+                phy->sendControlMsgToMac(new cMessage("RxStartStatus", MacToPhyInterface::PHY_RX_END_WITH_FAILURE));
+            }
+
+            if (static_cast<DeciderResult80211*>(result)->isCollision()) {
+                phy->sendControlMsgToMac(new cMessage("Error", Decider80211p::COLLISION));
+            }
+            else {
+                phy->sendControlMsgToMac(new cMessage("Error", Decider80211p::BITERROR));
+            }
+        }
+        delete result;
+    }
+
+    if (phy11p->getRadioState() == Radio::TX) {
+        EV_TRACE << "I'm currently sending\n";
+    }
+    // check if channel is idle now
+    // we declare channel busy if CCA tells us so, or if we are currently
+    // decoding a frame
+    else if (cca() == false || currentSignal.first != 0) {
+        EV_TRACE << "Channel not yet idle!\n";
+    }
+    else {
+        // might have been idle before (when the packet rxpower was below sens)
+        if (isChannelIdle != true) {
+            EV_TRACE << "Channel idle now!\n";
+            setChannelIdleStatus(true);
+        }
+    }
+    return notAgain;
+}
+
+void Decider80211pAbstract::setChannelIdleStatus(bool isIdle)
+{
+    isChannelIdle = isIdle;
+    if (isIdle)
+        phy->sendControlMsgToMac(new cMessage("ChannelStatus", Mac80211pToPhy11pInterface::CHANNEL_IDLE));
+    else
+        phy->sendControlMsgToMac(new cMessage("ChannelStatus", Mac80211pToPhy11pInterface::CHANNEL_BUSY));
+}
+
+void Decider80211pAbstract::changeFrequency(double freq)
+{
+    if (freq == centerFrequency) return;
+    centerFrequency = freq;
+    recomputeChannelPower();
+}
+
+void Decider80211pAbstract::setCCAThreshold(double ccaThreshold_dBm)
+{
+    ccaThreshold = pow(10, ccaThreshold_dBm / 10);
+}
+
+void Decider80211pAbstract::setNotifyRxStart(bool enable)
+{
+    notifyRxStart = enable;
+}
+
+void Decider80211pAbstract::switchToTx()
+{
+    if (currentSignal.first != 0) {
+        // we are currently trying to receive a frame.
+        if (allowTxDuringRx) {
+            // if the above layer decides to transmit anyhow, we need to abort reception
+            AirFrame11pAbstract* currentFrame = check_and_cast<AirFrame11pAbstract*>(currentSignal.first);
+            // flag the frame as "while transmitting"
+            currentFrame->setWasTransmitting(true);
+            currentFrame->setBitError(true);
+            // forget about the signal
+            currentSignal.first = 0;
+        }
+        else {
+            throw cRuntimeError("Decider80211pAbstract: mac layer requested phy to transmit a frame while currently receiving another");
+        }
+    }
+}
+
+void Decider80211pAbstract::finish()
+{
+    simtime_t totalTime = simTime() - myStartTime;
+    phy->recordScalar("busyTime", myBusyTime / totalTime.dbl());
+    if (collectCollisionStats) {
+        phy->recordScalar("ncollisions", collisions);
+    }
+}
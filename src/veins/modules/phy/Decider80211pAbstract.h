@@ -0,0 +1,163 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+
+#include "veins/base/phyLayer/BaseDecider.h"
+#include "veins/modules/phy/Decider80211p.h"
+#include "veins/modules/phy/PERTable.h"
+
+namespace veins {
+
+class AirFrame11pAbstract;
+
+/**
+ * @brief
+ * Link-level counterpart of Decider80211p, used by PhyLayer80211pAbstract.
+ *
+ * Instead of inspecting Signals, the decider works on the scalar receive power stored in each AirFrame11pAbstract.
+ * It keeps a running sum of the power of all frames on its channel, which is used both for carrier sensing and for the SINR of the frame it is synced to:
+ * the SINR is taken at the highest interference level seen after the preamble of that frame.
+ * Whether the frame is decoded is drawn from a PERTable, scaled from the table's reference length to the length of the frame.
+ *
+ * Sends the same control messages to the MAC as Decider80211p.
+ *
+ * @ingroup decider
+ *
+ * @see PhyLayer80211pAbstract
+ * @see Decider80211p
+ */
+class VEINS_API Decider80211pAbstract : public BaseDecider {
+protected:
+    /** @brief CCA threshold (in mW). See Decider80211p for details */
+    double ccaThreshold;
+
+    /** @brief allows/disallows interruption of current reception for txing. See Decider80211p for details */
+    bool allowTxDuringRx;
+
+    /** @brief The center frequency on which the decider listens for signals */
+    double centerFrequency;
+
+    /** @brief Packet error rates to draw reception success from */
+    std::shared_ptr<const PERTable> perTable;
+
+    /** @brief Length (in bits) of the frames perTable refers to */
+    double perTableReferenceLength;
+
+    double myBusyTime;
+    double myStartTime;
+
+    Decider80211pToPhy80211pInterface* phy11p;
+    std::map<AirFrame*, int> signalStates;
+
+    /** @brief Sum of the receive power (in mW) of all frames on the current channel */
+    double channelPower = 0;
+
+    /** @brief Number of frames contributing to channelPower */
+    size_t numChannelFrames = 0;
+
+    /** @brief End of the preamble of the frame currently synced to */
+    simtime_t syncedPreambleEnd;
+
+    /** @brief Highest interference (in mW) the frame currently synced to has experienced after its preamble */
+    double syncedMaxInterference = 0;
+
+    /** @brief enable/disable statistics collection for collisions. See Decider80211p for details */
+    bool collectCollisionStats;
+    /** @brief count the number of collisions */
+    unsigned int collisions;
+
+    /** @brief notify PHY-RXSTART.indication  */
+    bool notifyRxStart;
+
+protected:
+    simtime_t processNewSignal(AirFrame* frame) override;
+
+    simtime_t processSignalEnd(AirFrame* frame) override;
+
+    /**
+     * @brief Decides whether the frame the decider is synced to has been received correctly.
+     */
+    virtual DeciderResult* checkIfSignalOk(AirFrame11pAbstract* frame);
+
+    /**
+     * @brief Returns whether a frame contributes to the power sensed on the current channel.
+     */
+    bool isOnChannel(AirFrame11pAbstract* frame) const;
+
+    /**
+     * @brief Accounts the current interference level to the frame the decider is synced to.
+     *
+     * Must be called before every change of channelPower.
+     */
+    void updateSyncedInterference();
+
+    void addChannelPower(double power_mW);
+
+    void removeChannelPower(double power_mW);
+
+    /**
+     * @brief Recomputes channelPower from the frames currently on air, e.g., after a channel switch.
+     */
+    void recomputeChannelPower();
+
+    /** @brief Draws whether a frame of the given length is decoded, returning the result in terms of Decider80211p::PACKET_OK_RESULT */
+    Decider80211p::PACKET_OK_RESULT packetOk(double sinr, double snr, int lengthMPDU, uint64_t datarate);
+
+public:
+    /**
+     * @brief Initializes the Decider with a pointer to its PhyLayer and
+     * specific values for threshold and minPowerLevel
+     */
+    Decider80211pAbstract(cComponent* owner, DeciderToPhyInterface* phy, double minPowerLevel, double ccaThreshold, bool allowTxDuringRx, double centerFrequency, std::shared_ptr<const PERTable> perTable, double perTableReferenceLength, int myIndex = -1, bool collectCollisionStatistics = false);
+
+    bool cca();
+    int getSignalState(AirFrame* frame) override;
+
+    void changeFrequency(double freq);
+
+    /**
+     * @brief sets the CCA threshold
+     */
+    void setCCAThreshold(double ccaThreshold_dBm);
+
+    void setChannelIdleStatus(bool isIdle) override;
+
+    /**
+     * @brief invoke this method when the phy layer is also finalized,
+     * so that statistics recorded by the decider can be written to
+     * the output file
+     */
+    void finish() override;
+
+    void switchToTx() override;
+
+    /**
+     * @brief notify PHY-RXSTART.indication
+     */
+    void setNotifyRxStart(bool enable);
+};
+
+} // namespace veins
@@ -36,6 +36,13 @@ class VEINS_API Decider80211pToPhy80211pInterface {
 public:
     virtual ~Decider80211pToPhy80211pInterface(){};
     virtual int getRadioState() = 0;
+
+    /**
+     * @brief Returns the mean interference power (in mW) of distant transmitters during [start, end].
+     *
+     * These transmitters are not represented by AirFrames, see the nearFieldDist parameter of ConnectionManager.
+     */
+    virtual double getFarFieldInterference(simtime_t_cref start, simtime_t_cref end, double centerFrequency) = 0;
 };
 
 } // namespace veins
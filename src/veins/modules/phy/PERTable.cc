@@ -0,0 +1,127 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/phy/PERTable.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using namespace veins;
+
+PERTable::PERTable(std::istream& in, const std::string& name)
+    : name(name)
+{
+    std::map<uint64_t, std::vector<std::pair<double, double>>> entries;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        std::istringstream fields(line);
+        std::string first;
+        if (!(fields >> first) || first[0] == '#') continue;
+
+        std::istringstream datarateField(first);
+        uint64_t datarate;
+        double snr_dB;
+        double per;
+        std::string rest;
+        if (!(datarateField >> datarate) || !datarateField.eof() || !(fields >> snr_dB >> per) || (fields >> rest)) {
+            throw cRuntimeError("%s, line %d: expected \"<datarate> <SNR in dB> <PER>\", got \"%s\"", name.c_str(), lineNumber, line.c_str());
+        }
+        if (per < 0 || per > 1) {
+            throw cRuntimeError("%s, line %d: packet error rate %f is not in [0, 1]", name.c_str(), lineNumber, per);
+        }
+        entries[datarate].emplace_back(snr_dB, per);
+    }
+
+    if (entries.empty()) {
+        throw cRuntimeError("%s does not contain any entries", name.c_str());
+    }
+
+    for (auto& datarateEntries : entries) {
+        auto& points = datarateEntries.second;
+        std::sort(points.begin(), points.end());
+        Curve& curve = curves[datarateEntries.first];
+        for (const auto& point : points) {
+            if (!curve.snr_dB.empty() && curve.snr_dB.back() == point.first) {
+                throw cRuntimeError("%s contains more than one entry for datarate %lu and SNR %f dB", name.c_str(), static_cast<unsigned long>(datarateEntries.first), point.first);
+            }
+            curve.snr_dB.push_back(point.first);
+            curve.per.push_back(point.second);
+        }
+    }
+}
+
+namespace {
+
+/**
+ * Returns the process-wide registry of PER tables, keyed by file name.
+ *
+ * Only weak references are kept, so a table is freed once no PHY is using it anymore.
+ */
+std::map<std::string, std::weak_ptr<const PERTable>>& sharedTables()
+{
+    static std::map<std::string, std::weak_ptr<const PERTable>> tables;
+    return tables;
+}
+
+} // namespace
+
+std::shared_ptr<const PERTable> PERTable::load(const std::string& fileName)
+{
+    std::weak_ptr<const PERTable>& entry = sharedTables()[fileName];
+    std::shared_ptr<const PERTable> table = entry.lock();
+    if (!table) {
+        std::ifstream file(fileName);
+        if (!file) {
+            throw cRuntimeError("Could not open PER table \"%s\"", fileName.c_str());
+        }
+        table = std::make_shared<PERTable>(file, fileName);
+        entry = table;
+    }
+    return table;
+}
+
+bool PERTable::hasDatarate(uint64_t datarate) const
+{
+    return curves.find(datarate) != curves.end();
+}
+
+double PERTable::getPER(uint64_t datarate, double snr_dB) const
+{
+    auto it = curves.find(datarate);
+    if (it == curves.end()) {
+        throw cRuntimeError("%s does not contain any entries for datarate %lu", name.c_str(), static_cast<unsigned long>(datarate));
+    }
+    const Curve& curve = it->second;
+
+    auto upper = std::upper_bound(curve.snr_dB.begin(), curve.snr_dB.end(), snr_dB);
+    if (upper == curve.snr_dB.begin()) return curve.per.front();
+    if (upper == curve.snr_dB.end()) return curve.per.back();
+
+    size_t i = upper - curve.snr_dB.begin();
+    double fraction = (snr_dB - curve.snr_dB[i - 1]) / (curve.snr_dB[i] - curve.snr_dB[i - 1]);
+    return curve.per[i - 1] + fraction * (curve.per[i] - curve.per[i - 1]);
+}
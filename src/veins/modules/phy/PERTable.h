@@ -0,0 +1,87 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief Packet error rates over SNR for a set of data rates, as used by Decider80211pAbstract.
+ *
+ * The table is read from a text file with one entry per line of the form
+ *
+ *     <datarate in bit/s> <SNR in dB> <packet error rate>
+ *
+ * Empty lines and lines starting with '#' are ignored.
+ * Entries of a data rate need not be sorted.
+ * Between entries, the packet error rate is interpolated linearly; outside, the nearest entry is used.
+ *
+ * All packet error rates refer to frames of one reference length, which is not part of the file.
+ *
+ * @ingroup phyLayer
+ */
+class VEINS_API PERTable {
+public:
+    /**
+     * Parses a table from the given stream.
+     *
+     * @param in the stream to read from
+     * @param name the name of the table to use in error messages
+     */
+    PERTable(std::istream& in, const std::string& name = "PER table");
+
+    /**
+     * Returns the table stored in the given file.
+     *
+     * Tables are immutable, so each file is only read once as long as some PHY is still using it.
+     */
+    static std::shared_ptr<const PERTable> load(const std::string& fileName);
+
+    /**
+     * Returns whether the table contains entries for the given data rate.
+     */
+    bool hasDatarate(uint64_t datarate) const;
+
+    /**
+     * Returns the packet error rate of a frame sent at the given data rate and received with the given SNR (in dB).
+     */
+    double getPER(uint64_t datarate, double snr_dB) const;
+
+private:
+    struct Curve {
+        std::vector<double> snr_dB; ///< sorted in ascending order
+        std::vector<double> per;
+    };
+
+    std::string name;
+    std::map<uint64_t, Curve> curves;
+};
+
+} // namespace veins
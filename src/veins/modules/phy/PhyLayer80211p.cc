@@ -35,6 +35,7 @@
 #include "veins/modules/analogueModel/VehicleObstacleShadowing.h"
 #include "veins/modules/analogueModel/TwoRayInterferenceModel.h"
 #include "veins/modules/analogueModel/NakagamiFading.h"
+#include "veins/modules/analogueModel/StaticAnalogueModelChain.h"
 #include "veins/base/connectionManager/BaseConnectionManager.h"
 #include "veins/modules/utility/Consts80211p.h"
 #include "veins/modules/messages/AirFrame11p_m.h"
@@ -46,6 +47,20 @@ using std::unique_ptr;
 
 Define_Module(veins::PhyLayer80211p);
 
+namespace {
+
+/**
+ * Take ownership of an AnalogueModel created by one of the initialize methods, which is known to be of type T.
+ */
+template <typename T>
+unique_ptr<T> downcastAnalogueModel(unique_ptr<AnalogueModel> model)
+{
+    ASSERT(dynamic_cast<T*>(model.get()) != nullptr);
+    return unique_ptr<T>(static_cast<T*>(model.release()));
+}
+
+} // namespace
+
 void PhyLayer80211p::initialize(int stage)
 {
     if (stage == 0) {
@@ -53,6 +68,7 @@ void PhyLayer80211p::initialize(int stage)
         ccaThreshold = pow(10, par("ccaThreshold").doubleValue() / 10);
         allowTxDuringRx = par("allowTxDuringRx").boolValue();
         collectCollisionStatistics = par("collectCollisionStatistics").boolValue();
+        parallelDecisions = par("parallelDecisions").boolValue();
 
         // Create frequency mappings and initialize spectrum for signal representation
         Spectrum::Frequencies freqs;
@@ -91,6 +107,9 @@ unique_ptr<AnalogueModel> PhyLayer80211p::getAnalogueModelFromName(std::string n
     else if (name == "NakagamiFading") {
         return initializeNakagamiFading(params);
     }
+    else if (name == "SimplePathlossObstacleNakagamiChain") {
+        return initializeSimplePathlossObstacleNakagamiChain(params);
+    }
     return BasePhyLayer::getAnalogueModelFromName(name, params);
 }
 
@@ -146,7 +165,20 @@ unique_ptr<AnalogueModel> PhyLayer80211p::initializeBreakpointPathlossModel(Para
         throw cRuntimeError("Undefined parameters for breakpointPathlossModel. Please check your configuration.");
     }
 
-    return make_unique<BreakpointPathlossModel>(this, L01, L02, alpha1, alpha2, breakpointDistance, useTorus, playgroundSize);
+    // optional attenuation table
+    double tableResolution = 0;
+    double tableMaxDistance = 0;
+    it = params.find("tableResolution");
+    if (it != params.end()) {
+        tableResolution = it->second.doubleValue();
+        it = params.find("tableMaxDistance");
+        if (it == params.end()) {
+            throw cRuntimeError("BreakpointPathlossModel: tableResolution given, but no tableMaxDistance. Please check your configuration.");
+        }
+        tableMaxDistance = it->second.doubleValue();
+    }
+
+    return make_unique<BreakpointPathlossModel>(this, L01, L02, alpha1, alpha2, breakpointDistance, useTorus, playgroundSize, tableResolution, tableMaxDistance);
 }
 
 unique_ptr<AnalogueModel> PhyLayer80211p::initializeTwoRayInterferenceModel(ParameterMap& params)
@@ -155,7 +187,28 @@ unique_ptr<AnalogueModel> PhyLayer80211p::initializeTwoRayInterferenceModel(Para
 
     double dielectricConstant = params["DielectricConstant"].doubleValue();
 
-    return make_unique<TwoRayInterferenceModel>(this, dielectricConstant);
+    // optional attenuation table
+    double tableResolution = 0;
+    double tableMaxDistance = 0;
+    double tableHeightResolution = 0.001;
+    long tableCacheSize = 8;
+    if (params.count("TableResolution") == 1) {
+        if (params.count("TableMaxDistance") != 1) {
+            throw cRuntimeError("TwoRayInterferenceModel: TableResolution given, but no TableMaxDistance. Please check your configuration.");
+        }
+        tableResolution = params["TableResolution"].doubleValue();
+        tableMaxDistance = params["TableMaxDistance"].doubleValue();
+    }
+    if (params.count("TableHeightResolution") == 1) {
+        tableHeightResolution = params["TableHeightResolution"].doubleValue();
+        if (tableHeightResolution <= 0) throw cRuntimeError("TwoRayInterferenceModel: TableHeightResolution must be positive");
+    }
+    if (params.count("TableCacheSize") == 1) {
+        tableCacheSize = params["TableCacheSize"].longValue();
+        if (tableCacheSize < 0) throw cRuntimeError("TwoRayInterferenceModel: TableCacheSize must not be negative");
+    }
+
+    return make_unique<TwoRayInterferenceModel>(this, dielectricConstant, tableResolution, tableMaxDistance, tableHeightResolution, tableCacheSize);
 }
 
 unique_ptr<AnalogueModel> PhyLayer80211p::initializeNakagamiFading(ParameterMap& params)
@@ -168,6 +221,14 @@ unique_ptr<AnalogueModel> PhyLayer80211p::initializeNakagamiFading(ParameterMap&
     return make_unique<NakagamiFading>(this, constM, m);
 }
 
+unique_ptr<AnalogueModel> PhyLayer80211p::initializeSimplePathlossObstacleNakagamiChain(ParameterMap& params)
+{
+    auto pathloss = downcastAnalogueModel<SimplePathlossModel>(initializeSimplePathlossModel(params));
+    auto obstacleShadowing = downcastAnalogueModel<SimpleObstacleShadowing>(initializeSimpleObstacleShadowing(params));
+    auto fading = downcastAnalogueModel<NakagamiFading>(initializeNakagamiFading(params));
+    return make_unique<SimplePathlossObstacleNakagamiChain>(this, std::move(pathloss), std::move(obstacleShadowing), std::move(fading));
+}
+
 unique_ptr<AnalogueModel> PhyLayer80211p::initializeSimplePathlossModel(ParameterMap& params)
 {
 
@@ -254,7 +315,12 @@ unique_ptr<AnalogueModel> PhyLayer80211p::initializeVehicleObstacleShadowing(Par
 unique_ptr<Decider> PhyLayer80211p::initializeDecider80211p(ParameterMap& params)
 {
     double centerFreq = params["centerFrequency"];
-    auto dec = make_unique<Decider80211p>(this, this, minPowerLevel, ccaThreshold, allowTxDuringRx, centerFreq, findHost()->getIndex(), collectCollisionStatistics);
+    uint64_t randomStreamSeed = 0;
+    if (parallelDecisions) {
+        cRNG* rng = getRNG(0);
+        randomStreamSeed = (static_cast<uint64_t>(rng->intRand()) << 32) | rng->intRand();
+    }
+    auto dec = make_unique<Decider80211p>(this, this, minPowerLevel, ccaThreshold, allowTxDuringRx, centerFreq, findHost()->getIndex(), collectCollisionStatistics, parallelDecisions, randomStreamSeed);
     dec->setPath(getParentModule()->getFullPath());
     return unique_ptr<Decider>(std::move(dec));
 }
@@ -324,6 +390,7 @@ void PhyLayer80211p::attachSignal(AirFrame* airFrame, cObject* ctrlInfo)
     signal.setDataStart(freqIndex - 1);
     signal.setDataEnd(freqIndex + 1);
     signal.setCenterFrequencyIndex(freqIndex);
+    recordFarFieldTransmission(ctrlInfo11p->txPower_mW, IEEE80211ChannelFrequencies.at(ctrlInfo11p->channelNr), duration);
     // copy the signal into the AirFrame
     airFrame->setSignal(signal);
     airFrame->setDuration(signal.getDuration());
@@ -335,6 +402,11 @@ int PhyLayer80211p::getRadioState()
     return BasePhyLayer::getRadioState();
 };
 
+double PhyLayer80211p::getFarFieldInterference(simtime_t_cref start, simtime_t_cref end, double centerFrequency)
+{
+    return getFarFieldInterferencePower(start, end, centerFrequency);
+}
+
 simtime_t PhyLayer80211p::setRadioState(int rs)
 {
     if (rs == Radio::TX) decider->switchToTx();
@@ -73,6 +73,9 @@ protected:
     /** @brief enable/disable detection of packet collisions */
     bool collectCollisionStatistics;
 
+    /** @brief enable/disable evaluating simultaneous receptions in parallel. See Decider80211p for details */
+    bool parallelDecisions;
+
     /** @brief allows/disallows interruption of current reception for txing
      *
      * See detailed description in Decider80211p
@@ -139,6 +142,12 @@ protected:
      */
     std::unique_ptr<AnalogueModel> initializeNakagamiFading(ParameterMap& params);
 
+    /**
+     * @brief Creates a SimplePathlossModel, SimpleObstacleShadowing, and NakagamiFading
+     * with the passed parameter values and combines them into one SimplePathlossObstacleNakagamiChain.
+     */
+    std::unique_ptr<AnalogueModel> initializeSimplePathlossObstacleNakagamiChain(ParameterMap& params);
+
     /**
      * @brief Creates and returns an instance of the Decider with the specified
      * name.
@@ -178,6 +187,7 @@ protected:
     void handleSelfMessage(cMessage* msg) override;
     int getRadioState() override;
     simtime_t setRadioState(int rs) override;
+    double getFarFieldInterference(simtime_t_cref start, simtime_t_cref end, double centerFrequency) override;
 };
 
 } // namespace veins
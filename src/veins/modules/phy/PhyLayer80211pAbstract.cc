@@ -0,0 +1,393 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "veins/modules/phy/PhyLayer80211pAbstract.h"
+
+#include "veins/base/connectionManager/BaseConnectionManager.h"
+#include "veins/base/modules/BaseWorldUtility.h"
+#include "veins/base/phyLayer/PhyToMacControlInfo.h"
+#include "veins/base/utils/FindModule.h"
+#include "veins/modules/messages/AirFrame11pAbstract_m.h"
+#include "veins/modules/phy/PERTable.h"
+#include "veins/modules/utility/Consts80211p.h"
+#include "veins/modules/utility/MacToPhyControlInfo11p.h"
+
+using namespace veins;
+
+using std::unique_ptr;
+
+Define_Module(veins::PhyLayer80211pAbstract);
+
+void PhyLayer80211pAbstract::initialize(int stage)
+{
+    ChannelAccess::initialize(stage);
+
+    if (stage == 0) {
+        // if using sendDirect, make sure that messages arrive without delay
+#if OMNETPP_BUILDNUM < 1506
+        gate("radioIn")->setDeliverOnReceptionStart(true);
+#else
+        gate("radioIn")->setDeliverImmediately(true);
+#endif
+
+        upperLayerIn = findGate("upperLayerIn");
+        upperLayerOut = findGate("upperLayerOut");
+        upperControlOut = findGate("upperControlOut");
+        upperControlIn = findGate("upperControlIn");
+
+        if (par("useNoiseFloor").boolValue()) {
+            noiseFloorValue = FWMath::dBm2mW(par("noiseFloor").doubleValue());
+        }
+        minPowerLevel = FWMath::dBm2mW(par("minPowerLevel").doubleValue());
+        ccaThreshold = FWMath::dBm2mW(par("ccaThreshold").doubleValue());
+        pathLossAlpha = par("pathLossAlpha").doubleValue();
+
+        world = FindModule<BaseWorldUtility*>::findGlobalModule();
+        if (world == nullptr) {
+            throw cRuntimeError("Could not find BaseWorldUtility module");
+        }
+
+        if (cc->hasPar("alpha") && pathLossAlpha < cc->par("alpha").doubleValue()) {
+            throw cRuntimeError("pathLossAlpha can't be smaller than alpha specified in ConnectionManager. Please adjust your omnetpp.ini file accordingly.");
+        }
+        if (cc->hasPar("sat") && (minPowerLevel - FWMath::dBm2mW(cc->par("sat").doubleValue())) < -0.000001) {
+            throw cRuntimeError("minPowerLevel can't be smaller than the signal attenuation threshold (sat) in ConnectionManager. Please adjust your omnetpp.ini file accordingly.");
+        }
+
+        radio = initializeRadio();
+
+        auto perTable = PERTable::load(par("perTable").stdstringValue());
+        double perTableReferenceLength = par("perTableReferenceLength").doubleValue();
+        double centerFrequency = IEEE80211ChannelFrequencies.at(Channel::cch);
+        decider = make_unique<Decider80211pAbstract>(this, this, minPowerLevel, ccaThreshold, par("allowTxDuringRx").boolValue(), centerFrequency, perTable, perTableReferenceLength, findHost()->getIndex(), par("collectCollisionStatistics").boolValue());
+
+        radioSwitchingOverTimer = new cMessage("radio switching over", RADIO_SWITCHING_OVER);
+        txOverTimer = new cMessage("transmission over", TX_OVER);
+    }
+}
+
+unique_ptr<Radio> PhyLayer80211pAbstract::initializeRadio()
+{
+    auto radio = Radio::createNewRadio(par("recordStats").boolValue(), par("initialRadioState"), par("initialRadioChannel"), par("nbRadioChannels"));
+
+    radio->setSwitchTime(Radio::RX, Radio::TX, par("timeRXToTX").doubleValue());
+    radio->setSwitchTime(Radio::SLEEP, Radio::TX, par("timeSleepToTX").doubleValue());
+    radio->setSwitchTime(Radio::TX, Radio::RX, par("timeTXToRX").doubleValue());
+    radio->setSwitchTime(Radio::SLEEP, Radio::RX, par("timeSleepToRX").doubleValue());
+    radio->setSwitchTime(Radio::TX, Radio::SLEEP, par("timeTXToSleep").doubleValue());
+    radio->setSwitchTime(Radio::RX, Radio::SLEEP, par("timeRXToSleep").doubleValue());
+
+    return radio;
+}
+
+void PhyLayer80211pAbstract::finish()
+{
+    decider->finish();
+}
+
+PhyLayer80211pAbstract::~PhyLayer80211pAbstract()
+{
+    for (auto frame : activeFrames) {
+        cancelAndDelete(frame);
+    }
+    if (txOverTimer) {
+        cancelAndDelete(txOverTimer);
+    }
+    if (radioSwitchingOverTimer) {
+        cancelAndDelete(radioSwitchingOverTimer);
+    }
+}
+
+// --Message handling--------------------------------------
+
+void PhyLayer80211pAbstract::handleMessage(cMessage* msg)
+{
+    if (msg->isSelfMessage()) {
+        handleSelfMessage(msg);
+    }
+    else if (msg->getArrivalGateId() == upperLayerIn) {
+        handleUpperMessage(msg);
+    }
+    else if (msg->getArrivalGateId() == upperControlIn) {
+        delete msg;
+        throw cRuntimeError("Received unknown control message from upper layer!");
+    }
+    else if (msg->getKind() == AIR_FRAME) {
+        if (auto frame = dynamic_cast<AirFrame11pAbstract*>(msg)) {
+            handleAirFrameStartReceive(frame);
+        }
+        else {
+            EV_TRACE << "Ignoring AirFrame " << msg << " of another PHY type." << endl;
+            delete msg;
+        }
+    }
+    else {
+        EV << "Unknown message received." << endl;
+        delete msg;
+    }
+}
+
+void PhyLayer80211pAbstract::handleSelfMessage(cMessage* msg)
+{
+    switch (msg->getKind()) {
+    case TX_OVER: {
+        ASSERT(msg == txOverTimer);
+        sendControlMsgToMac(new cMessage("Transmission over", TX_OVER));
+        // check if there is another packet on the chan, and change the chan-state to idle
+        if (decider->cca()) {
+            // chan is idle
+            EV_TRACE << "Channel idle after transmit!\n";
+            decider->setChannelIdleStatus(true);
+        }
+        else {
+            EV_TRACE << "Channel not yet idle after transmit!\n";
+        }
+        break;
+    }
+    case RADIO_SWITCHING_OVER:
+        ASSERT(msg == radioSwitchingOverTimer);
+        radio->endSwitch(simTime());
+        sendControlMsgToMac(new cMessage("Radio switching over", RADIO_SWITCHING_OVER));
+        break;
+
+    case AIR_FRAME:
+        handleAirFrameEndReceive(check_and_cast<AirFrame11pAbstract*>(msg));
+        break;
+
+    default:
+        break;
+    }
+}
+
+void PhyLayer80211pAbstract::handleAirFrameStartReceive(AirFrame11pAbstract* frame)
+{
+    EV_TRACE << "Received new AirFrame " << frame << " from channel." << endl;
+
+    activeFrames.insert(frame);
+
+    frame->setRecvPower_mW(computeRecvPower(frame));
+
+    // the frame returns as a self message at the end of its reception
+    scheduleAt(decider->processSignal(frame), frame);
+}
+
+void PhyLayer80211pAbstract::handleAirFrameEndReceive(AirFrame11pAbstract* frame)
+{
+    EV_TRACE << "End of Airframe with ID " << frame->getId() << "." << endl;
+
+    decider->processSignal(frame);
+    activeFrames.erase(frame);
+    delete frame;
+}
+
+double PhyLayer80211pAbstract::computeRecvPower(const AirFrame11pAbstract* frame) const
+{
+    const Coord receiverPos = antennaPosition.getPositionAt();
+    const Coord senderPos = frame->getConstPoa().pos.getPositionAt();
+    double sqrDistance = world->useTorus() ? receiverPos.sqrTorusDist(senderPos, *world->getPgs()) : receiverPos.sqrdist(senderPos);
+
+    // no attenuation in the near field, as in SimplePathlossModel
+    if (sqrDistance <= 1.0) return frame->getTxPower_mW();
+
+    double wavelength = BaseWorldUtility::speedOfLight() / frame->getCenterFrequency();
+    double wavelengthFactor = wavelength * wavelength / (16.0 * M_PI * M_PI);
+    return frame->getTxPower_mW() * wavelengthFactor * pow(sqrDistance, -pathLossAlpha / 2.0);
+}
+
+void PhyLayer80211pAbstract::handleUpperMessage(cMessage* msg)
+{
+    // check if Radio is in TX state
+    if (radio->getCurrentState() != Radio::TX) {
+        delete msg;
+        throw cRuntimeError("Error: message for sending received, but radio not in state TX");
+    }
+
+    // check if not already sending
+    if (txOverTimer->isScheduled()) {
+        delete msg;
+        throw cRuntimeError("Error: message for sending received, but radio already sending");
+    }
+
+    unique_ptr<AirFrame11pAbstract> frame = encapsMsg(check_and_cast<cPacket*>(msg));
+    frame->setPoa({antennaPosition, antennaHeading.toCoord(), nullptr});
+
+    scheduleAt(simTime() + frame->getDuration(), txOverTimer);
+
+    recordFarFieldTransmission(frame->getTxPower_mW(), frame->getCenterFrequency(), frame->getDuration());
+    sendToChannel(frame.release());
+}
+
+unique_ptr<AirFrame11pAbstract> PhyLayer80211pAbstract::encapsMsg(cPacket* macPkt)
+{
+    auto ctrlInfo = unique_ptr<cObject>(macPkt->removeControlInfo());
+    const auto ctrlInfo11p = check_and_cast<MacToPhyControlInfo11p*>(ctrlInfo.get());
+
+    auto frame = make_unique<AirFrame11pAbstract>(macPkt->getName(), AIR_FRAME);
+
+    frame->setSchedulingPriority(airFramePriority());
+    frame->setProtocolId(IEEE_80211_ABSTRACT);
+    frame->setId(world->getUniqueAirFrameId());
+    frame->setChannel(radio->getCurrentChannel());
+    frame->setBitLength(0);
+    frame->encapsulate(macPkt);
+
+    const auto duration = getFrameDuration(macPkt->getBitLength(), ctrlInfo11p->mcs);
+    ASSERT(duration > 0);
+    frame->setDuration(duration);
+    frame->setMcs(static_cast<int>(ctrlInfo11p->mcs));
+    frame->setTxPower_mW(ctrlInfo11p->txPower_mW);
+    frame->setCenterFrequency(IEEE80211ChannelFrequencies.at(ctrlInfo11p->channelNr));
+
+    return frame;
+}
+
+// --Mac80211pToPhy11pInterface implementation-----------------------
+
+void PhyLayer80211pAbstract::changeListeningChannel(Channel channel)
+{
+    decider->changeFrequency(IEEE80211ChannelFrequencies.at(channel));
+}
+
+void PhyLayer80211pAbstract::setCCAThreshold(double ccaThreshold_dBm)
+{
+    ccaThreshold = FWMath::dBm2mW(ccaThreshold_dBm);
+    decider->setCCAThreshold(ccaThreshold_dBm);
+}
+
+void PhyLayer80211pAbstract::notifyMacAboutRxStart(bool enable)
+{
+    decider->setNotifyRxStart(enable);
+}
+
+void PhyLayer80211pAbstract::requestChannelStatusIfIdle()
+{
+    Enter_Method_Silent();
+    if (decider->cca()) {
+        // chan is idle
+        EV_TRACE << "Request channel status: channel idle!\n";
+        decider->setChannelIdleStatus(true);
+    }
+}
+
+simtime_t PhyLayer80211pAbstract::getFrameDuration(int payloadLengthBits, MCS mcs) const
+{
+    Enter_Method_Silent();
+    ASSERT(mcs != MCS::undefined);
+    auto ndbps = getNDBPS(mcs);
+    // calculate frame duration according to Equation (17-29) of the IEEE 802.11-2007 standard
+    return PHY_HDR_PREAMBLE_DURATION + PHY_HDR_PLCPSIGNAL_DURATION + T_SYM_80211P * ceil(static_cast<double>(16 + payloadLengthBits + 6) / (ndbps));
+}
+
+// --MacToPhyInterface implementation-----------------------
+
+int PhyLayer80211pAbstract::getRadioState()
+{
+    Enter_Method_Silent();
+    return radio->getCurrentState();
+}
+
+double PhyLayer80211pAbstract::getFarFieldInterference(simtime_t_cref start, simtime_t_cref end, double centerFrequency)
+{
+    return getFarFieldInterferencePower(start, end, centerFrequency);
+}
+
+simtime_t PhyLayer80211pAbstract::setRadioState(int rs)
+{
+    Enter_Method_Silent();
+
+    if (rs == Radio::TX) decider->switchToTx();
+
+    if (txOverTimer && txOverTimer->isScheduled()) {
+        EV_WARN << "Switched radio while sending an AirFrame. The effects this would have on the transmission are not simulated by the PhyLayer80211pAbstract!";
+    }
+
+    simtime_t switchTime = radio->switchTo(rs, simTime());
+
+    // invalid switch time, we are probably already switching
+    if (switchTime < 0) return switchTime;
+
+    if (switchTime == 0.0) {
+        radio->endSwitch(simTime());
+        sendControlMsgToMac(new cMessage("Radio switching over", RADIO_SWITCHING_OVER));
+    }
+    else {
+        scheduleAt(simTime() + switchTime, radioSwitchingOverTimer);
+    }
+
+    return switchTime;
+}
+
+void PhyLayer80211pAbstract::setCurrentRadioChannel(int newRadioChannel)
+{
+    radio->setCurrentChannel(newRadioChannel);
+    decider->channelChanged(newRadioChannel);
+    EV_TRACE << "Switched radio to channel " << newRadioChannel << endl;
+}
+
+int PhyLayer80211pAbstract::getCurrentRadioChannel()
+{
+    return radio->getCurrentChannel();
+}
+
+int PhyLayer80211pAbstract::getNbRadioChannels()
+{
+    return par("nbRadioChannels");
+}
+
+// --DeciderToPhyInterface implementation------------
+
+void PhyLayer80211pAbstract::getChannelInfo(simtime_t_cref from, simtime_t_cref to, AirFrameVector& out)
+{
+    out.insert(out.end(), activeFrames.begin(), activeFrames.end());
+}
+
+double PhyLayer80211pAbstract::getNoiseFloorValue()
+{
+    return noiseFloorValue;
+}
+
+void PhyLayer80211pAbstract::sendControlMsgToMac(cMessage* msg)
+{
+    send(msg, upperControlOut);
+}
+
+void PhyLayer80211pAbstract::sendUp(AirFrame* frame, DeciderResult* result)
+{
+    EV_TRACE << "Decapsulating MacPacket from Airframe with ID " << frame->getId() << " and sending it up to MAC." << endl;
+
+    cMessage* packet = frame->decapsulate();
+    ASSERT(packet);
+
+    PhyToMacControlInfo::setControlInfo(packet, result);
+
+    send(packet, upperLayerOut);
+}
+
+BaseWorldUtility* PhyLayer80211pAbstract::getWorldUtility()
+{
+    return world;
+}
+
+void PhyLayer80211pAbstract::recordScalar(const char* name, double value, const char* unit)
+{
+    ChannelAccess::recordScalar(name, value, unit);
+}
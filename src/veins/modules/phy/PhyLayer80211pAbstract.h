@@ -0,0 +1,155 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <memory>
+#include <set>
+
+#include "veins/base/connectionManager/ChannelAccess.h"
+#include "veins/base/phyLayer/DeciderToPhyInterface.h"
+#include "veins/base/phyLayer/MacToPhyInterface.h"
+#include "veins/modules/mac/ieee80211p/Mac80211pToPhy11pInterface.h"
+#include "veins/modules/phy/Decider80211pToPhy80211pInterface.h"
+#include "veins/modules/phy/Decider80211pAbstract.h"
+
+namespace veins {
+
+class AirFrame11pAbstract;
+
+/**
+ * @brief
+ * Link-level alternative to PhyLayer80211p for large-scale studies.
+ *
+ * Frames carry a scalar transmit power instead of a Signal.
+ * On reception, a scalar receive power is computed from a log-distance path loss (isotropic antennas, no shadowing or fading),
+ * and Decider80211pAbstract decides about reception using a running interference sum and a table of packet error rates over SNR.
+ * The module offers the same interfaces to Mac1609_4 as PhyLayer80211p, so both can be exchanged by choosing a different NIC (see Nic80211pAbstract).
+ *
+ * Frames sent by PhyLayer80211p and PhyLayer80211pAbstract cannot be received by one another.
+ *
+ * @ingroup phyLayer
+ *
+ * @see Mac1609_4
+ * @see PhyLayer80211p
+ * @see Decider80211pAbstract
+ */
+class VEINS_API PhyLayer80211pAbstract : public ChannelAccess, public DeciderToPhyInterface, public MacToPhyInterface, public Mac80211pToPhy11pInterface, public Decider80211pToPhy80211pInterface {
+public:
+    ~PhyLayer80211pAbstract() override;
+
+    void initialize(int stage) override;
+    void finish() override;
+
+    /** @name Mac80211pToPhy11pInterface implementation */
+    /*@{*/
+    void changeListeningChannel(Channel channel) override;
+    void setCCAThreshold(double ccaThreshold_dBm) override;
+    void notifyMacAboutRxStart(bool enable) override;
+    void requestChannelStatusIfIdle() override;
+    simtime_t getFrameDuration(int payloadLengthBits, MCS mcs) const override;
+    /*@}*/
+
+    /** @name MacToPhyInterface implementation */
+    /*@{*/
+    int getRadioState() override;
+    simtime_t setRadioState(int rs) override;
+    void setCurrentRadioChannel(int newRadioChannel) override;
+    int getCurrentRadioChannel() override;
+    int getNbRadioChannels() override;
+    /*@}*/
+
+    /** @name Decider80211pToPhy80211pInterface implementation */
+    /*@{*/
+    double getFarFieldInterference(simtime_t_cref start, simtime_t_cref end, double centerFrequency) override;
+    /*@}*/
+
+    /** @name DeciderToPhyInterface implementation */
+    /*@{*/
+    /**
+     * Fill the given AirFrameVector with all AirFrames currently on air.
+     *
+     * As frames are deleted once they end, the interval is not taken into account.
+     */
+    void getChannelInfo(simtime_t_cref from, simtime_t_cref to, AirFrameVector& out) override;
+    double getNoiseFloorValue() override;
+    void sendControlMsgToMac(cMessage* msg) override;
+    void sendUp(AirFrame* packet, DeciderResult* result) override;
+    BaseWorldUtility* getWorldUtility() override;
+    void recordScalar(const char* name, double value, const char* unit = nullptr) override;
+    /*@}*/
+
+protected:
+    enum ProtocolIds {
+        IEEE_80211_ABSTRACT = 12124
+    };
+
+    /** @brief AirFrames use a slightly higher priority than normal to ensure channel consistency, see BasePhyLayer */
+    static short airFramePriority()
+    {
+        return 10;
+    }
+
+    double noiseFloorValue = 0; ///< Noise floor (in mW)
+    double minPowerLevel; ///< The minimum receive power (in mW) needed to even attempt decoding a frame
+    double ccaThreshold; ///< CCA threshold (in mW)
+    double pathLossAlpha; ///< Path loss exponent of the log-distance path loss
+
+    std::unique_ptr<Radio> radio; ///< The state machine storing the current radio state (TX, RX, SLEEP)
+    std::unique_ptr<Decider80211pAbstract> decider;
+
+    /** @brief AirFrames currently being received (owned by this module) */
+    std::set<AirFrame*> activeFrames;
+
+    int upperLayerIn; ///< The id of the in-data gate from the Mac layer.
+    int upperLayerOut; ///< The id of the out-data gate to the Mac layer.
+    int upperControlOut; ///< The id of the out-control gate to the Mac layer.
+    int upperControlIn; ///< The id of the in-control gate from the Mac layer.
+
+    cMessage* radioSwitchingOverTimer = nullptr; ///< Self message scheduled to the point in time when the switching process of the radio is over.
+    cMessage* txOverTimer = nullptr; ///< Self message scheduled to the point in time when the transmission of an AirFrame is over.
+
+protected:
+    void handleMessage(cMessage* msg) override;
+
+    /**
+     * Create and return the radio class to use.
+     */
+    virtual std::unique_ptr<Radio> initializeRadio();
+
+    virtual void handleSelfMessage(cMessage* msg);
+    virtual void handleUpperMessage(cMessage* msg);
+    virtual void handleAirFrameStartReceive(AirFrame11pAbstract* frame);
+    virtual void handleAirFrameEndReceive(AirFrame11pAbstract* frame);
+
+    /**
+     * Encapsulate a MacPkt into an AirFrame11pAbstract, according to its MacToPhyControlInfo11p.
+     */
+    virtual std::unique_ptr<AirFrame11pAbstract> encapsMsg(cPacket* macPkt);
+
+    /**
+     * Return the power (in mW) with which the given frame is received by this PHY.
+     */
+    virtual double computeRecvPower(const AirFrame11pAbstract* frame) const;
+};
+
+} // namespace veins
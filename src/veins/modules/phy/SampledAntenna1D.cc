@@ -22,14 +22,26 @@
 //
 
 #include "veins/modules/phy/SampledAntenna1D.h"
+
+#include <algorithm>
+
 #include "veins/base/utils/FWMath.h"
 
 using namespace veins;
 
-SampledAntenna1D::SampledAntenna1D(std::vector<double>& values, std::string offsetType, std::vector<double>& offsetParams, std::string rotationType, std::vector<double>& rotationParams, cRNG* rng)
-    : antennaGains(values.size() + 1)
+SampledAntenna1D::SampledAntenna1D(std::vector<double>& values, std::string offsetType, std::vector<double>& offsetParams, std::string rotationType, std::vector<double>& rotationParams, cRNG* rng, size_t tableSize)
+    : gainTable(tableSize + 1)
+    , entriesPerUnit(tableSize / 4.0)
 {
-    distance = (2 * M_PI) / values.size();
+    if (values.empty()) {
+        throw cRuntimeError("SampledAntenna1D::SampledAntenna1D(): No samples given.");
+    }
+    if (tableSize == 0 || tableSize % 4 != 0) {
+        throw cRuntimeError("SampledAntenna1D::SampledAntenna1D(): The size of the gain table has to be a positive multiple of 4.");
+    }
+
+    double distance = (2 * M_PI) / values.size();
+    std::vector<double> antennaGains(values.size() + 1);
 
     // instantiate a random number generator for sample offsets if one is specified
     cRandom* offsetGen = nullptr;
@@ -63,7 +75,7 @@ SampledAntenna1D::SampledAntenna1D(std::vector<double>& values, std::string offs
     else if (rotationType == "triang") {
         rotationGen = new cTriang(rng, rotationParams[0], rotationParams[1], rotationParams[2]);
     }
-    rotation = (rotationGen == nullptr) ? 0 : rotationGen->draw();
+    double rotation = (rotationGen == nullptr) ? 0 : rotationGen->draw();
     if (rotationGen != nullptr) delete rotationGen;
 
     // transform to rad
@@ -83,42 +95,83 @@ SampledAntenna1D::SampledAntenna1D(std::vector<double>& values, std::string offs
 
     // assign the value of 0 degrees to 360 degrees as well to assure correct interpolation (size allocated already before)
     antennaGains[values.size()] = antennaGains[0];
+
+    // tabulate the (rotated) pattern in the linear domain, indexed by pseudo-angle
+    for (size_t i = 0; i < tableSize; i++) {
+        double angle = pseudoAngleToAngle(i / entriesPerUnit) - rotation;
+
+        // make sure angle is within [0, 2*M_PI)
+        angle = fmod(angle, 2 * M_PI);
+        if (angle < 0) angle += 2 * M_PI;
+
+        size_t baseElement = std::min(static_cast<size_t>(angle / distance), values.size() - 1);
+        double offset = (angle - (baseElement * distance)) / distance;
+
+        double gainValue = antennaGains[baseElement] + offset * (antennaGains[baseElement + 1] - antennaGains[baseElement]);
+        gainTable[i] = FWMath::dBm2mW(gainValue);
+    }
+    gainTable[tableSize] = gainTable[0];
 }
 
 SampledAntenna1D::~SampledAntenna1D()
 {
 }
 
+double SampledAntenna1D::getPseudoAngle(double x, double y)
+{
+    if (y >= 0) {
+        if (x > 0) return y / (x + y);
+        if (y == 0) return (x < 0) ? 2 : 0;
+        return 1 - x / (-x + y);
+    }
+    if (x < 0) return 2 - y / (-x - y);
+    return 3 + x / (x - y);
+}
+
+double SampledAntenna1D::pseudoAngleToAngle(double pseudoAngle)
+{
+    // construct a representative vector for the pseudo-angle (the inverse of getPseudoAngle)
+    int quadrant = static_cast<int>(pseudoAngle);
+    double p = pseudoAngle - quadrant;
+    double x;
+    double y;
+    switch (quadrant % 4) {
+    case 0:
+        x = 1 - p;
+        y = p;
+        break;
+    case 1:
+        x = -p;
+        y = 1 - p;
+        break;
+    case 2:
+        x = p - 1;
+        y = -p;
+        break;
+    default:
+        x = p;
+        y = p - 1;
+        break;
+    }
+    return atan2(y, x);
+}
+
 double SampledAntenna1D::getGain(Coord ownPos, Coord ownOrient, Coord otherPos)
 {
     // get the line of sight vector
     Coord los = otherPos - ownPos;
-    // calculate angle using atan2
-    double angle = atan2(los.y, los.x) - atan2(ownOrient.y, ownOrient.x);
 
-    // apply possible rotation
-    angle -= rotation;
+    // express it relative to the antenna's orientation (without normalizing, as the pseudo-angle is scale invariant)
+    double dot = ownOrient.x * los.x + ownOrient.y * los.y;
+    double cross = ownOrient.x * los.y - ownOrient.y * los.x;
 
-    // make sure angle is within [0, 2*M_PI)
-    angle = fmod(angle, 2 * M_PI);
-    if (angle < 0) angle += 2 * M_PI;
+    // look up gain, interpolating between neighboring table entries
+    double position = getPseudoAngle(dot, cross) * entriesPerUnit;
+    size_t baseElement = static_cast<size_t>(position);
+    double offset = position - baseElement;
 
-    // calculate antennaGain
-    size_t baseElement = angle / distance;
-    double offset = (angle - (baseElement * distance)) / distance;
+    // guard against rounding up to a full turn (the last entry equals the first one)
+    if (baseElement >= gainTable.size() - 1) return gainTable.back();
 
-    // make sure to not address an element out of antennaGains (baseElement == lastElement implies that offset is zero)
-    ASSERT((baseElement < antennaGains.size()) && (baseElement != antennaGains.size() - 1 || offset == 0));
-
-    double gainValue = antennaGains[baseElement];
-    if (offset > 0) {
-        gainValue += offset * (antennaGains[baseElement + 1] - antennaGains[baseElement]);
-    }
-
-    return FWMath::dBm2mW(gainValue);
-}
-
-double SampledAntenna1D::getLastAngle()
-{
-    return lastAngle / M_PI * 180.0;
+    return gainTable[baseElement] + offset * (gainTable[baseElement + 1] - gainTable[baseElement]);
 }
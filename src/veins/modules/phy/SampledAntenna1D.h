@@ -34,9 +34,18 @@ namespace veins {
  * The respective gain is therefore dependent on the azimuth angle.
  * The user has to provide the samples, which are assumed to be distributed equidistantly.
  * As the power is assumed to be relative to an isotropic radiator, the values have to be given in dBi.
- * The values are stored in a mapping automatically supporting linear interpolation between samples.
  * Optional randomness in terms of sample offsets and antenna rotation is supported.
  *
+ * On construction, the samples (linearly interpolated in dBi, rotated, and converted to linear gains) are tabulated at a fine resolution.
+ * The table is not indexed by the azimuth angle itself but by its pseudo-angle (see getPseudoAngle()),
+ * which can be computed from the dot and cross product of orientation and line of sight without calling atan2.
+ * Between table entries, gains are interpolated linearly in the linear domain.
+ * The deviation from interpolating the raw samples in dBi is bounded by the change of the pattern over one table step,
+ * which is at most 0.12 degrees with the default table size (e.g., below 0.03 dB for samples 90 degrees and 20 dB apart).
+ * Table entries coincide with the raw samples whenever the number of samples divides the table size evenly (e.g., 4, 8, 16, ... samples).
+ *
+ * Once constructed, an instance is immutable and can be shared among all PHYs using the same configuration (see BasePhyLayer::initializeSampledAntenna1D()).
+ *
  * * An example antenna.xml for this Antenna can be the following:
  * @verbatim
     <?xml version="1.0" encoding="UTF-8"?>
@@ -77,8 +86,9 @@ public:
      * @param rotationType      - name of random distribution to use for the random rotation of the whole antenna
      * @param rotationParams    - contains the parameters for the rotation random distribution
      * @param rng               - pointer to the random number generator to use
+     * @param tableSize         - number of entries of the precomputed gain table covering the full circle (must be a multiple of 4)
      */
-    SampledAntenna1D(std::vector<double>& values, std::string offsetType, std::vector<double>& offsetParams, std::string rotationType, std::vector<double>& rotationParams, cRNG* rng);
+    SampledAntenna1D(std::vector<double>& values, std::string offsetType, std::vector<double>& offsetParams, std::string rotationType, std::vector<double>& rotationParams, cRNG* rng, size_t tableSize = defaultTableSize);
 
     /**
      * @brief Destructor of the sampled antenna.
@@ -94,26 +104,41 @@ public:
      * @param ownOrient     - states the direction the antenna (i.e. the car) is pointing at
      * @param otherPos      - coordinates of the other antenna which this antenna is currently communicating with
      * @return Returns the gain this antenna achieves depending on the computed direction.
-     * If the angle is within two samples, linear interpolation is applied.
+     * If the angle is within two table entries, linear interpolation is applied.
      */
     double getGain(Coord ownPos, Coord ownOrient, Coord otherPos) override;
 
-    double getLastAngle() override;
+    /**
+     * @brief Default number of entries of the gain table (i.e., a resolution of roughly 0.09 degrees).
+     */
+    static const size_t defaultTableSize = 4096;
+
+    /**
+     * @brief Returns the pseudo-angle of the vector (x, y) in [0, 4).
+     *
+     * The pseudo-angle is a monotonic function of the angle atan2(y, x) that coincides with it at multiples of 45 degrees
+     * (i.e., 0, 0.5, 1, ... correspond to 0, 45, 90, ... degrees).
+     * A zero vector yields 0.
+     */
+    static double getPseudoAngle(double x, double y);
 
 private:
     /**
-     * @brief Used to store the antenna's samples.
+     * @brief Returns the angle (in rad) corresponding to the given pseudo-angle.
      */
-    std::vector<double> antennaGains;
-    double distance;
+    static double pseudoAngleToAngle(double pseudoAngle);
 
     /**
-     * @brief An optional random rotation of the antenna is stored in this field and applied every time
-     * the gain has to be calculated.
+     * @brief Linear gains indexed by quantized pseudo-angle, already including the antenna's rotation.
+     *
+     * The first entry is repeated at the end to allow interpolation without wrap-around.
      */
-    double rotation;
+    std::vector<double> gainTable;
 
-    double lastAngle;
+    /**
+     * @brief Number of table entries per unit of pseudo-angle.
+     */
+    double entriesPerUnit;
 };
 
 } // namespace veins
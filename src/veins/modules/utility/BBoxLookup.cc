@@ -21,72 +21,13 @@
 //
 
 #include <cmath>
+#include <limits>
+#include <unordered_map>
 
 #include "veins/modules/utility/BBoxLookup.h"
-
-namespace {
-
-using Point = veins::BBoxLookup::Point;
-using Box = veins::BBoxLookup::Box;
-
-/**
- * Helper structure representing a wireless ray from a sender to a receiver.
- *
- * Contains pre-computed values to speed up calls to intersect with the same ray but different boxes.
- */
-struct Ray {
-    Point origin;
-    Point destination;
-    Point direction;
-    Point invDirection;
-    struct {
-        size_t x;
-        size_t y;
-    } sign;
-    double length;
-};
-
-/**
- * Return a Ray struct for fast intersection tests from sender to receiver.
- */
-Ray makeRay(const Point& sender, const Point& receiver)
-{
-    const double dir_x = receiver.x - sender.x;
-    const double dir_y = receiver.y - sender.y;
-    Ray ray;
-    ray.origin = sender;
-    ray.destination = receiver;
-    ray.length = std::sqrt(dir_x * dir_x + dir_y * dir_y);
-    ray.direction.x = dir_x / ray.length;
-    ray.direction.y = dir_y / ray.length;
-    ray.invDirection.x = 1.0 / ray.direction.x;
-    ray.invDirection.y = 1.0 / ray.direction.y;
-    ray.sign.x = ray.invDirection.x < 0;
-    ray.sign.y = ray.invDirection.y < 0;
-    return ray;
-}
-/**
- * Return whether ray intersects with box.
- *
- * Based on:
- * Amy Williams, Steve Barrus, R. Keith Morley & Peter Shirley (2005) An Efficient and Robust Ray-Box Intersection Algorithm, Journal of Graphics Tools, 10:1, 49-54, DOI: 10.1080/2151237X.2005.10129188
- */
-bool intersects(const Ray& ray, const Box& box)
-{
-    const double x[2]{box.p1.x, box.p2.x};
-    const double y[2]{box.p1.y, box.p2.y};
-    double tmin = (x[ray.sign.x] - ray.origin.x) * ray.invDirection.x;
-    double tmax = (x[1 - ray.sign.x] - ray.origin.x) * ray.invDirection.x;
-    double tymin = (y[ray.sign.y] - ray.origin.y) * ray.invDirection.y;
-    double tymax = (y[1 - ray.sign.y] - ray.origin.y) * ray.invDirection.y;
-
-    if ((tmin > tymax) || (tymin > tmax)) return false;
-    if (tymin > tmin) tmin = tymin;
-    if (tymax < tmax) tmax = tymax;
-    return (tmin < ray.length) && (tmax > 0);
-}
-
-} // anonymous namespace
+#include "veins/modules/utility/BBoxRay.h"
+#include "veins/modules/utility/BinaryStream.h"
+#include "veins/modules/utility/ObstacleIndices.h"
 
 namespace veins {
 
@@ -107,16 +48,18 @@ BBoxLookup::BBoxLookup(const std::vector<Obstacle*>& obstacles, std::function<BB
     const size_t numCells = numCols * numRows;
     std::vector<std::vector<BBoxLookup::Box>> protoCells(numCells);
     std::vector<std::vector<Obstacle*>> protoLookup(numCells);
+    std::vector<std::vector<uint32_t>> protoIds(numCells);
     // fill protoCells with boundingBoxes
     size_t numEntries = 0;
     for (const auto obstaclePtr : obstacles) {
+        // number obstacles, so queries can keep track of the ones already found
+        const uint32_t id = idsByObstacle.emplace(obstaclePtr, static_cast<uint32_t>(idsByObstacle.size())).first->second;
         auto bbox = makeBBox(obstaclePtr);
-        const size_t fromCol = std::min(size_t(std::max(0, int(bbox.p1.x / cellSize))), numCols - 1);
-        const size_t toCol = std::min(size_t(std::max(0, int(bbox.p2.x / cellSize))), numCols - 1);
-        const size_t fromRow = std::min(size_t(std::max(0, int(bbox.p1.y / cellSize))), numRows - 1);
-        const size_t toRow = std::min(size_t(std::max(0, int(bbox.p2.y / cellSize))), numRows - 1);
-        for (size_t row = fromRow; row <= toRow; ++row) {
-            for (size_t col = fromCol; col <= toCol; ++col) {
+        bboxesById.resize(idsByObstacle.size());
+        bboxesById[id] = bbox;
+        const CellRange cells = getCells(bbox);
+        for (size_t row = cells.fromRow; row <= cells.toRow; ++row) {
+            for (size_t col = cells.fromCol; col <= cells.toCol; ++col) {
                 ASSERT(row >= 0);
                 ASSERT(col >= 0);
                 ASSERT(row < numRows);
@@ -124,15 +67,19 @@ BBoxLookup::BBoxLookup(const std::vector<Obstacle*>& obstacles, std::function<BB
                 const size_t cellIndex = col + row * numCols;
                 protoCells[cellIndex].push_back(bbox);
                 protoLookup[cellIndex].push_back(obstaclePtr);
+                protoIds[cellIndex].push_back(id);
                 ++numEntries;
                 ASSERT(protoCells[cellIndex].size() == protoLookup[cellIndex].size());
             }
         }
     }
 
+    numObstacles = idsByObstacle.size();
+
     // phase 2: derive read-only data structure with fast lookup
     bboxes.reserve(numEntries);
     obstacleLookup.reserve(numEntries);
+    obstacleIds.reserve(numEntries);
     bboxCells.reserve(numCells);
     size_t index = 0;
     for (size_t row = 0; row < numRows; ++row) {
@@ -140,12 +87,14 @@ BBoxLookup::BBoxLookup(const std::vector<Obstacle*>& obstacles, std::function<BB
             const size_t cellIndex = col + row * numCols;
             auto& currentCell = protoCells.at(cellIndex);
             auto& currentLookup = protoLookup.at(cellIndex);
+            auto& currentIds = protoIds.at(cellIndex);
             ASSERT(currentCell.size() == currentLookup.size());
             const size_t count = currentCell.size();
             // copy over bboxes and obstacle lookups (in strict order)
             for (size_t entryIndex = 0; entryIndex < count; ++entryIndex) {
                 bboxes.push_back(currentCell.at(entryIndex));
                 obstacleLookup.push_back(currentLookup.at(entryIndex));
+                obstacleIds.push_back(currentIds.at(entryIndex));
             }
             // create lookup table for this cell
             bboxCells.push_back({index, count});
@@ -156,48 +105,228 @@ BBoxLookup::BBoxLookup(const std::vector<Obstacle*>& obstacles, std::function<BB
     }
     ASSERT(bboxes.size() == numEntries);
     ASSERT(bboxes.size() == obstacleLookup.size());
+    insertedEntries.resize(numCells);
+}
+
+BBoxLookup::CellRange BBoxLookup::getCells(const Box& bbox) const
+{
+    return {
+        std::min(size_t(std::max(0, int(bbox.p1.x / cellSize))), numCols - 1),
+        std::min(size_t(std::max(0, int(bbox.p2.x / cellSize))), numCols - 1),
+        std::min(size_t(std::max(0, int(bbox.p1.y / cellSize))), numRows - 1),
+        std::min(size_t(std::max(0, int(bbox.p2.y / cellSize))), numRows - 1),
+    };
+}
+
+void BBoxLookup::insert(Obstacle* obstacle, const Box& bbox)
+{
+    ASSERT(!bboxCells.empty());
+    remove(obstacle);
+    const uint32_t id = static_cast<uint32_t>(numObstacles++);
+    idsByObstacle[obstacle] = id;
+    bboxesById.push_back(bbox);
+    const CellRange cells = getCells(bbox);
+    for (size_t row = cells.fromRow; row <= cells.toRow; ++row) {
+        for (size_t col = cells.fromCol; col <= cells.toCol; ++col) {
+            insertedEntries[col + row * numCols].push_back({bbox, obstacle, id});
+        }
+    }
+}
+
+void BBoxLookup::remove(Obstacle* obstacle)
+{
+    auto it = idsByObstacle.find(obstacle);
+    if (it == idsByObstacle.end()) return;
+    const uint32_t id = it->second;
+    idsByObstacle.erase(it);
+
+    // an empty box never overlaps a transmission, so the entry can stay in its cell
+    const double inf = std::numeric_limits<double>::infinity();
+    const Box empty{{inf, inf}, {-inf, -inf}};
+    const CellRange cells = getCells(bboxesById[id]);
+    for (size_t row = cells.fromRow; row <= cells.toRow; ++row) {
+        for (size_t col = cells.fromCol; col <= cells.toCol; ++col) {
+            const size_t cellIndex = col + row * numCols;
+            const BBoxCell& cell = bboxCells[cellIndex];
+            for (size_t bboxIndex = cell.index; bboxIndex < cell.index + cell.count; ++bboxIndex) {
+                if (obstacleIds[bboxIndex] != id) continue;
+                bboxes[bboxIndex] = empty;
+                obstacleLookup[bboxIndex] = nullptr;
+            }
+            auto& inserted = insertedEntries[cellIndex];
+            inserted.erase(std::remove_if(inserted.begin(), inserted.end(), [id](const InsertedEntry& entry) { return entry.id == id; }), inserted.end());
+        }
+    }
 }
 
 std::vector<Obstacle*> BBoxLookup::findOverlapping(Point sender, Point receiver) const
 {
     std::vector<Obstacle*> overlappingObstacles;
+    Mailbox mailbox;
+    findOverlapping(sender, receiver, overlappingObstacles, mailbox);
+    return overlappingObstacles;
+}
+
+void BBoxLookup::findOverlapping(Point sender, Point receiver, std::vector<Obstacle*>& result, Mailbox& mailbox) const
+{
+    result.clear();
+    if (bboxCells.empty()) return;
+
     const Box bbox{
         {std::min(sender.x, receiver.x), std::min(sender.y, receiver.y)},
         {std::max(sender.x, receiver.x), std::max(sender.y, receiver.y)},
     };
 
-    // determine coordinates for all cells touched by bbox
-    const size_t firstCol = std::min(size_t(std::max(0, int(bbox.p1.x / cellSize))), numCols - 1);
-    const size_t lastCol = std::min(size_t(std::max(0, int(bbox.p2.x / cellSize))), numCols - 1);
-    const size_t firstRow = std::min(size_t(std::max(0, int(bbox.p1.y / cellSize))), numRows - 1);
-    const size_t lastRow = std::min(size_t(std::max(0, int(bbox.p2.y / cellSize))), numRows - 1);
-    ASSERT(lastCol < numCols && lastRow < numRows);
     // precompute transmission ray properties
     const Ray ray = makeRay(sender, receiver);
-    // iterate over cells
-    for (size_t row = firstRow; row <= lastRow; ++row) {
-        for (size_t col = firstCol; col <= lastCol; ++col) {
-            // skip cell if ray does not intersect with the cell.
-            const Box cellBox = {{static_cast<double>(col * cellSize), static_cast<double>(row * cellSize)}, {static_cast<double>((col + 1) * cellSize), static_cast<double>((row + 1) * cellSize)}};
-            if (!intersects(ray, cellBox)) continue;
-            // derive cell for current cell coordinates
-            const size_t cellIndex = col + row * numCols;
-            const BBoxCell& cell = bboxCells.at(cellIndex);
-            // iterate over bboxes in each cell
-            for (size_t bboxIndex = cell.index; bboxIndex < cell.index + cell.count; ++bboxIndex) {
-                const Box& current = bboxes.at(bboxIndex);
-                // check for overlap with bbox (fast rejection)
-                if (current.p2.x < bbox.p1.x) continue;
-                if (current.p1.x > bbox.p2.x) continue;
-                if (current.p2.y < bbox.p1.y) continue;
-                if (current.p1.y > bbox.p2.y) continue;
-                // derive corresponding obstacle
-                if (!intersects(ray, current)) continue;
-                overlappingObstacles.push_back(obstacleLookup.at(bboxIndex));
-            }
+    // sender and receiver coincide: there is no ray to intersect with
+    if (!(ray.length > 0)) return;
+
+    // start a new query: obstacles stamped with an older epoch have not been found yet
+    if (mailbox.stamps.size() < numObstacles) {
+        mailbox.stamps.assign(numObstacles, 0);
+    }
+    if (++mailbox.epoch == 0) {
+        std::fill(mailbox.stamps.begin(), mailbox.stamps.end(), 0);
+        mailbox.epoch = 1;
+    }
+
+    // clip the ray to the grid, parametrized by distance from the sender
+    double tEnter = 0;
+    double tExit = ray.length;
+    const double gridSize[2]{static_cast<double>(numCols * cellSize), static_cast<double>(numRows * cellSize)};
+    const double origin[2]{ray.origin.x, ray.origin.y};
+    const double direction[2]{ray.direction.x, ray.direction.y};
+    for (int axis = 0; axis < 2; ++axis) {
+        if (direction[axis] == 0) {
+            if (origin[axis] < 0 || origin[axis] > gridSize[axis]) return;
+            continue;
         }
+        double t1 = (0 - origin[axis]) / direction[axis];
+        double t2 = (gridSize[axis] - origin[axis]) / direction[axis];
+        if (t1 > t2) std::swap(t1, t2);
+        tEnter = std::max(tEnter, t1);
+        tExit = std::min(tExit, t2);
     }
-    return overlappingObstacles;
+    if (tEnter > tExit) return;
+
+    auto cellOf = [this](double coordinate, size_t count) {
+        return std::min(size_t(std::max(0.0, std::floor(coordinate / cellSize))), count - 1);
+    };
+    size_t col = cellOf(ray.origin.x + ray.direction.x * tEnter, numCols);
+    size_t row = cellOf(ray.origin.y + ray.direction.y * tEnter, numRows);
+    const size_t lastCol = cellOf(ray.origin.x + ray.direction.x * tExit, numCols);
+    const size_t lastRow = cellOf(ray.origin.y + ray.direction.y * tExit, numRows);
+
+    // 2D DDA (Amanatides & Woo): walk from cell to cell along the ray, always crossing the nearest cell border next
+    const int stepCol = lastCol > col ? 1 : -1;
+    const int stepRow = lastRow > row ? 1 : -1;
+    size_t colsLeft = lastCol > col ? lastCol - col : col - lastCol;
+    size_t rowsLeft = lastRow > row ? lastRow - row : row - lastRow;
+    const double infinity = std::numeric_limits<double>::infinity();
+    const double tDeltaCol = colsLeft ? cellSize * std::abs(ray.invDirection.x) : infinity;
+    const double tDeltaRow = rowsLeft ? cellSize * std::abs(ray.invDirection.y) : infinity;
+    double tNextCol = colsLeft ? (static_cast<double>((stepCol > 0 ? col + 1 : col) * cellSize) - ray.origin.x) * ray.invDirection.x : infinity;
+    double tNextRow = rowsLeft ? (static_cast<double>((stepRow > 0 ? row + 1 : row) * cellSize) - ray.origin.y) * ray.invDirection.y : infinity;
+
+    while (true) {
+        const size_t cellIndex = col + row * numCols;
+        const BBoxCell& cell = bboxCells[cellIndex];
+        // iterate over bboxes in each cell
+        for (size_t bboxIndex = cell.index; bboxIndex < cell.index + cell.count; ++bboxIndex) {
+            // skip obstacles already tested in a previous cell
+            uint32_t& stamp = mailbox.stamps[obstacleIds[bboxIndex]];
+            if (stamp == mailbox.epoch) continue;
+            stamp = mailbox.epoch;
+            const Box& current = bboxes[bboxIndex];
+            // check for overlap with bbox (fast rejection)
+            if (current.p2.x < bbox.p1.x) continue;
+            if (current.p1.x > bbox.p2.x) continue;
+            if (current.p2.y < bbox.p1.y) continue;
+            if (current.p1.y > bbox.p2.y) continue;
+            // derive corresponding obstacle
+            if (!intersects(ray, current)) continue;
+            result.push_back(obstacleLookup[bboxIndex]);
+        }
+        // same for obstacles inserted after construction
+        for (const InsertedEntry& entry : insertedEntries[cellIndex]) {
+            uint32_t& stamp = mailbox.stamps[entry.id];
+            if (stamp == mailbox.epoch) continue;
+            stamp = mailbox.epoch;
+            const Box& current = entry.bbox;
+            if (current.p2.x < bbox.p1.x) continue;
+            if (current.p1.x > bbox.p2.x) continue;
+            if (current.p2.y < bbox.p1.y) continue;
+            if (current.p1.y > bbox.p2.y) continue;
+            if (!intersects(ray, current)) continue;
+            result.push_back(entry.obstacle);
+        }
+
+        // step count is fixed by first and last cell, so rounding errors cannot make the walk overshoot
+        if (colsLeft == 0 && rowsLeft == 0) break;
+        if (rowsLeft == 0 || (colsLeft > 0 && tNextCol < tNextRow)) {
+            col += stepCol;
+            tNextCol += tDeltaCol;
+            --colsLeft;
+        }
+        else {
+            row += stepRow;
+            tNextRow += tDeltaRow;
+            --rowsLeft;
+        }
+    }
+}
+
+void BBoxLookup::write(BinaryWriter& out, const std::vector<Obstacle*>& obstacles) const
+{
+    ASSERT(std::all_of(insertedEntries.begin(), insertedEntries.end(), [](const std::vector<InsertedEntry>& cell) { return cell.empty(); }));
+    out.write<int32_t>(cellSize);
+    out.write<uint64_t>(numCols);
+    out.write<uint64_t>(numRows);
+    out.write<uint64_t>(numObstacles);
+    out.writeArray(bboxCells);
+    out.writeArray(bboxes);
+    out.writeArray(obstacleindices::toIndices(obstacleLookup, obstacles));
+    out.writeArray(obstacleIds);
+    out.writeArray(bboxesById);
+}
+
+BBoxLookup BBoxLookup::read(BinaryReader& in, const std::vector<Obstacle*>& obstacles)
+{
+    BBoxLookup lookup;
+    lookup.cellSize = in.read<int32_t>();
+    lookup.numCols = in.read<uint64_t>();
+    lookup.numRows = in.read<uint64_t>();
+    lookup.numObstacles = in.read<uint64_t>();
+    in.readArray(lookup.bboxCells);
+    in.readArray(lookup.bboxes);
+    std::vector<uint32_t> indices;
+    in.readArray(indices);
+    lookup.obstacleLookup = obstacleindices::toPointers(indices, obstacles);
+    in.readArray(lookup.obstacleIds);
+    in.readArray(lookup.bboxesById);
+    if (lookup.bboxCells.size() != lookup.numCols * lookup.numRows || lookup.obstacleLookup.size() != lookup.bboxes.size() || lookup.obstacleIds.size() != lookup.bboxes.size() || lookup.bboxesById.size() != lookup.numObstacles) {
+        throw cRuntimeError("Stored BBoxLookup is inconsistent");
+    }
+    if (lookup.cellSize <= 0 && !lookup.bboxCells.empty()) {
+        throw cRuntimeError("Stored BBoxLookup has a cell size of %d", lookup.cellSize);
+    }
+    // every stored index is used without further checks by findOverlapping
+    for (const auto& cell : lookup.bboxCells) {
+        if (cell.index > lookup.bboxes.size() || cell.count > lookup.bboxes.size() - cell.index) {
+            throw cRuntimeError("Stored BBoxLookup cell refers to bboxes beyond the %u stored", static_cast<unsigned>(lookup.bboxes.size()));
+        }
+    }
+    for (auto id : lookup.obstacleIds) {
+        if (id >= lookup.numObstacles) {
+            throw cRuntimeError("Stored BBoxLookup obstacle id %u exceeds the %u ids assigned", id, static_cast<unsigned>(lookup.numObstacles));
+        }
+    }
+    for (size_t i = 0; i < lookup.bboxes.size(); ++i) {
+        if (lookup.obstacleLookup[i]) lookup.idsByObstacle[lookup.obstacleLookup[i]] = lookup.obstacleIds[i];
+    }
+    lookup.insertedEntries.resize(lookup.bboxCells.size());
+    return lookup;
 }
 
 } // namespace veins
@@ -23,7 +23,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <unordered_map>
 #include <vector>
 
 #include "veins/veins.h"
@@ -31,6 +33,8 @@
 namespace veins {
 
 class Obstacle;
+class BinaryReader;
+class BinaryWriter;
 
 /**
  * Fast grid-based spatial datastructure to find obstacles (geometric shapes) in a bounding box.
@@ -61,6 +65,18 @@ public:
         size_t count; /**< number of elements in this cell; index + number = index of last element */
     };
 
+    /**
+     * Scratch space of findOverlapping to report each obstacle only once per query.
+     *
+     * Can be reused for any number of queries (and lookups), but must not be shared by concurrent queries.
+     */
+    class Mailbox {
+    private:
+        friend class BBoxLookup;
+        std::vector<uint32_t> stamps; /**< per obstacle: epoch of the last query that reported it */
+        uint32_t epoch = 0;
+    };
+
     BBoxLookup() = default;
     BBoxLookup(const std::vector<Obstacle*>& obstacles, std::function<BBoxLookup::Box(Obstacle*)> makeBBox, double scenarioX, double scenarioY, int cellSize = 250);
 
@@ -68,14 +84,73 @@ public:
      * Return all obstacles which have their bounding box touched by the transmission from sender to receiver.
      *
      * The obstacles itself may not actually overlap with transmission (false positives are possible).
+     * Each obstacle is returned only once.
      */
     std::vector<Obstacle*> findOverlapping(Point sender, Point receiver) const;
 
+    /**
+     * Same as findOverlapping(Point, Point), but reuses the memory of result and mailbox.
+     *
+     * Only visits the cells crossed by the transmission.
+     * Obstacles are appended to result (after clearing it) in the order their cells are crossed.
+     */
+    void findOverlapping(Point sender, Point receiver, std::vector<Obstacle*>& result, Mailbox& mailbox) const;
+
+    /**
+     * Add an obstacle with the given bounding box, only touching the cells it covers.
+     */
+    void insert(Obstacle* obstacle, const Box& bbox);
+
+    /**
+     * Remove an obstacle (added at construction or by insert), only touching the cells it covers.
+     *
+     * Does nothing if the obstacle is not stored.
+     */
+    void remove(Obstacle* obstacle);
+
+    /**
+     * Write this lookup to out, referring to obstacles by their index in obstacles (which must hold all stored obstacles).
+     *
+     * Obstacles added by insert() are not supported, so write a freshly built lookup.
+     */
+    void write(BinaryWriter& out, const std::vector<Obstacle*>& obstacles) const;
+
+    /**
+     * Read a lookup written by write(), given the same obstacles in the same order.
+     */
+    static BBoxLookup read(BinaryReader& in, const std::vector<Obstacle*>& obstacles);
+
 private:
+    struct CellRange {
+        size_t fromCol;
+        size_t toCol;
+        size_t fromRow;
+        size_t toRow;
+    };
+
+    /**
+     * Return the cells covered by bbox (clamped to the grid).
+     */
+    CellRange getCells(const Box& bbox) const;
+
+    /**
+     * Obstacle added by insert(), kept outside the contiguous cell layout.
+     */
+    struct InsertedEntry {
+        Box bbox;
+        Obstacle* obstacle;
+        uint32_t id;
+    };
+
     // NOTE: obstacles may occur multiple times in bboxes/obstacleLookup (if they are in multiple cells)
     std::vector<Box> bboxes; /**< ALL bboxes in one chunck of contiguos memory, ordered by cells */
     std::vector<Obstacle*> obstacleLookup; /**< bboxes[i] belongs to instance in obstacleLookup[i] */
+    std::vector<uint32_t> obstacleIds; /**< bboxes[i] belongs to the obstacleIds[i]-th distinct obstacle (used as index into Mailbox) */
+    size_t numObstacles = 0; /**< number of ids assigned so far */
+    std::unordered_map<Obstacle*, uint32_t> idsByObstacle; /**< ids of stored obstacles */
+    std::vector<Box> bboxesById; /**< bbox of each obstacle, by id */
     std::vector<BBoxCell> bboxCells; /**< flattened matrix of X * Y BBoxCell instances */
+    std::vector<std::vector<InsertedEntry>> insertedEntries; /**< per cell (same order as bboxCells): obstacles added by insert() */
     int cellSize = 0;
     size_t numCols = 0; /**< X BBoxCell instances in a row */
     size_t numRows = 0; /**< Y BBoxCell instances in a column */
@@ -0,0 +1,89 @@
+//
+// Copyright (C) 2019 Dominik S. Buse <buse@ccs-labs.org>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <cmath>
+
+#include "veins/modules/utility/BBoxLookup.h"
+
+namespace veins {
+
+/**
+ * Helper structure representing a wireless ray from a sender to a receiver.
+ *
+ * Contains pre-computed values to speed up calls to intersect with the same ray but different boxes.
+ */
+struct Ray {
+    BBoxLookup::Point origin;
+    BBoxLookup::Point destination;
+    BBoxLookup::Point direction;
+    BBoxLookup::Point invDirection;
+    struct {
+        size_t x;
+        size_t y;
+    } sign;
+    double length;
+};
+
+/**
+ * Return a Ray struct for fast intersection tests from sender to receiver.
+ */
+inline Ray makeRay(const BBoxLookup::Point& sender, const BBoxLookup::Point& receiver)
+{
+    const double dir_x = receiver.x - sender.x;
+    const double dir_y = receiver.y - sender.y;
+    Ray ray;
+    ray.origin = sender;
+    ray.destination = receiver;
+    ray.length = std::sqrt(dir_x * dir_x + dir_y * dir_y);
+    ray.direction.x = dir_x / ray.length;
+    ray.direction.y = dir_y / ray.length;
+    ray.invDirection.x = 1.0 / ray.direction.x;
+    ray.invDirection.y = 1.0 / ray.direction.y;
+    ray.sign.x = ray.invDirection.x < 0;
+    ray.sign.y = ray.invDirection.y < 0;
+    return ray;
+}
+
+/**
+ * Return whether ray intersects with box.
+ *
+ * Based on:
+ * Amy Williams, Steve Barrus, R. Keith Morley & Peter Shirley (2005) An Efficient and Robust Ray-Box Intersection Algorithm, Journal of Graphics Tools, 10:1, 49-54, DOI: 10.1080/2151237X.2005.10129188
+ */
+inline bool intersects(const Ray& ray, const BBoxLookup::Box& box)
+{
+    const double x[2]{box.p1.x, box.p2.x};
+    const double y[2]{box.p1.y, box.p2.y};
+    double tmin = (x[ray.sign.x] - ray.origin.x) * ray.invDirection.x;
+    double tmax = (x[1 - ray.sign.x] - ray.origin.x) * ray.invDirection.x;
+    double tymin = (y[ray.sign.y] - ray.origin.y) * ray.invDirection.y;
+    double tymax = (y[1 - ray.sign.y] - ray.origin.y) * ray.invDirection.y;
+
+    if ((tmin > tymax) || (tymin > tmax)) return false;
+    if (tymin > tmin) tmin = tymin;
+    if (tymax < tmax) tmax = tymax;
+    return (tmin < ray.length) && (tmax > 0);
+}
+
+} // namespace veins
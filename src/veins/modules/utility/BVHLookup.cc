@@ -0,0 +1,353 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <limits>
+
+#include "veins/modules/utility/BVHLookup.h"
+#include "veins/modules/utility/BBoxRay.h"
+#include "veins/modules/utility/BinaryStream.h"
+#include "veins/modules/utility/ObstacleIndices.h"
+
+namespace {
+
+using Point = veins::BBoxLookup::Point;
+using Box = veins::BBoxLookup::Box;
+
+const size_t numBins = 16;
+
+/**
+ * Depth below which subtrees are split at the median instead of by SAH, which bounds the depth of the tree.
+ */
+const size_t maxSahDepth = 32;
+
+Box emptyBox()
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    return {{inf, inf}, {-inf, -inf}};
+}
+
+void grow(Box& box, const Box& other)
+{
+    box.p1.x = std::min(box.p1.x, other.p1.x);
+    box.p1.y = std::min(box.p1.y, other.p1.y);
+    box.p2.x = std::max(box.p2.x, other.p2.x);
+    box.p2.y = std::max(box.p2.y, other.p2.y);
+}
+
+/**
+ * Half the perimeter of box: the 2D equivalent of a box's surface area, proportional to the probability of a random ray crossing it.
+ */
+double halfPerimeter(const Box& box)
+{
+    return (box.p2.x - box.p1.x) + (box.p2.y - box.p1.y);
+}
+
+double centroid(const Box& box, int axis)
+{
+    return axis == 0 ? (box.p1.x + box.p2.x) / 2 : (box.p1.y + box.p2.y) / 2;
+}
+
+bool overlaps(const Box& a, const Box& b)
+{
+    return !(a.p2.x < b.p1.x || a.p1.x > b.p2.x || a.p2.y < b.p1.y || a.p1.y > b.p2.y);
+}
+
+} // anonymous namespace
+
+namespace veins {
+
+BVHLookup::BVHLookup(const std::vector<Obstacle*>& obstacles, std::function<Box(Obstacle*)> makeBBox, size_t maxLeafSize)
+{
+    ASSERT(maxLeafSize > 0);
+    if (obstacles.empty()) return;
+
+    std::vector<Box> boxes;
+    boxes.reserve(obstacles.size());
+    for (const auto obstaclePtr : obstacles) {
+        boxes.push_back(makeBBox(obstaclePtr));
+    }
+
+    std::vector<uint32_t> order(obstacles.size());
+    for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+
+    // a binary tree with n leaves has at most 2n - 1 nodes
+    nodes.reserve(2 * obstacles.size());
+    nodes.push_back({});
+    nodes[0].parent = noNode;
+    root = 0;
+    build(0, 0, static_cast<uint32_t>(obstacles.size()), order, boxes, maxLeafSize, 0);
+
+    // store obstacles in leaf order, so each leaf covers a contiguous range
+    bboxes.reserve(order.size());
+    obstacleLookup.reserve(order.size());
+    for (auto i : order) {
+        indexByObstacle[obstacles[i]] = static_cast<uint32_t>(bboxes.size());
+        bboxes.push_back(boxes[i]);
+        obstacleLookup.push_back(obstacles[i]);
+    }
+}
+
+void BVHLookup::insert(Obstacle* obstacle, const Box& bbox)
+{
+    remove(obstacle);
+    const uint32_t index = static_cast<uint32_t>(bboxes.size());
+    indexByObstacle[obstacle] = index;
+    bboxes.push_back(bbox);
+    obstacleLookup.push_back(obstacle);
+
+    const uint32_t leaf = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({bbox, index, 1, noNode, noNode});
+    if (root == noNode) {
+        root = leaf;
+        return;
+    }
+
+    // descend to the sibling whose box grows least when including the new one
+    uint32_t sibling = root;
+    while (nodes[sibling].count == 0) {
+        const Node& node = nodes[sibling];
+        Box left = nodes[node.first].box;
+        Box right = nodes[node.second].box;
+        const double leftBefore = halfPerimeter(left);
+        const double rightBefore = halfPerimeter(right);
+        grow(left, bbox);
+        grow(right, bbox);
+        sibling = (halfPerimeter(left) - leftBefore) <= (halfPerimeter(right) - rightBefore) ? node.first : node.second;
+    }
+
+    // replace sibling by a new inner node holding both sibling and leaf
+    const uint32_t parent = nodes[sibling].parent;
+    const uint32_t inner = static_cast<uint32_t>(nodes.size());
+    Box innerBox = nodes[sibling].box;
+    grow(innerBox, bbox);
+    nodes.push_back({innerBox, sibling, 0, leaf, parent});
+    nodes[sibling].parent = inner;
+    nodes[leaf].parent = inner;
+    if (parent == noNode) {
+        root = inner;
+    }
+    else if (nodes[parent].first == sibling) {
+        nodes[parent].first = inner;
+    }
+    else {
+        nodes[parent].second = inner;
+    }
+
+    // refit ancestors
+    for (uint32_t ancestor = parent; ancestor != noNode; ancestor = nodes[ancestor].parent) {
+        grow(nodes[ancestor].box, bbox);
+    }
+}
+
+void BVHLookup::remove(Obstacle* obstacle)
+{
+    auto it = indexByObstacle.find(obstacle);
+    if (it == indexByObstacle.end()) return;
+    // an empty box never overlaps a transmission, so the entry can stay in its leaf
+    bboxes[it->second] = emptyBox();
+    obstacleLookup[it->second] = nullptr;
+    indexByObstacle.erase(it);
+}
+
+void BVHLookup::build(uint32_t nodeIndex, uint32_t first, uint32_t count, std::vector<uint32_t>& order, const std::vector<Box>& boxes, size_t maxLeafSize, size_t depth)
+{
+    Box nodeBox = emptyBox();
+    Box centroidBox = emptyBox();
+    for (uint32_t i = first; i < first + count; ++i) {
+        const Box& box = boxes[order[i]];
+        grow(nodeBox, box);
+        grow(centroidBox, {{centroid(box, 0), centroid(box, 1)}, {centroid(box, 0), centroid(box, 1)}});
+    }
+    nodes[nodeIndex].box = nodeBox;
+    nodes[nodeIndex].first = first;
+    nodes[nodeIndex].count = count;
+    if (count <= maxLeafSize) return;
+
+    // bin centroids along the wider axis
+    const int axis = (centroidBox.p2.x - centroidBox.p1.x) >= (centroidBox.p2.y - centroidBox.p1.y) ? 0 : 1;
+    const double binMin = axis == 0 ? centroidBox.p1.x : centroidBox.p1.y;
+    const double binMax = axis == 0 ? centroidBox.p2.x : centroidBox.p2.y;
+    // all centroids coincide: no split can separate them
+    if (!(binMax > binMin)) return;
+    const double binScale = numBins / (binMax - binMin);
+    auto binOf = [&](const Box& box) {
+        return std::min(numBins - 1, static_cast<size_t>((centroid(box, axis) - binMin) * binScale));
+    };
+
+    std::array<Box, numBins> binBoxes;
+    std::array<uint32_t, numBins> binCounts{};
+    binBoxes.fill(emptyBox());
+    for (uint32_t i = first; i < first + count; ++i) {
+        const Box& box = boxes[order[i]];
+        const size_t bin = binOf(box);
+        grow(binBoxes[bin], box);
+        ++binCounts[bin];
+    }
+
+    // evaluate the SAH for splitting after each bin, sweeping from both sides
+    std::array<double, numBins - 1> leftCost;
+    Box sweepBox = emptyBox();
+    uint32_t sweepCount = 0;
+    for (size_t bin = 0; bin < numBins - 1; ++bin) {
+        grow(sweepBox, binBoxes[bin]);
+        sweepCount += binCounts[bin];
+        leftCost[bin] = sweepCount ? sweepCount * halfPerimeter(sweepBox) : 0;
+    }
+    double bestCost = std::numeric_limits<double>::infinity();
+    size_t bestSplit = 0;
+    sweepBox = emptyBox();
+    sweepCount = 0;
+    for (size_t bin = numBins - 1; bin > 0; --bin) {
+        grow(sweepBox, binBoxes[bin]);
+        sweepCount += binCounts[bin];
+        const double cost = leftCost[bin - 1] + (sweepCount ? sweepCount * halfPerimeter(sweepBox) : 0);
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSplit = bin;
+        }
+    }
+
+    // split into [first, mid) and [mid, first + count)
+    auto begin = order.begin() + first;
+    auto end = begin + count;
+    auto mid = begin;
+    if (depth < maxSahDepth) {
+        mid = std::partition(begin, end, [&](uint32_t i) { return binOf(boxes[i]) < bestSplit; });
+    }
+    if (mid == begin || mid == end) {
+        // all obstacles ended up on one side (or the tree got deep): fall back to splitting at the median
+        mid = begin + count / 2;
+        std::nth_element(begin, mid, end, [&](uint32_t a, uint32_t b) { return centroid(boxes[a], axis) < centroid(boxes[b], axis); });
+    }
+    const uint32_t leftCount = static_cast<uint32_t>(mid - begin);
+
+    const uint32_t leftIndex = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({});
+    nodes.push_back({});
+    nodes[nodeIndex].first = leftIndex;
+    nodes[nodeIndex].second = leftIndex + 1;
+    nodes[nodeIndex].count = 0;
+    nodes[leftIndex].parent = nodeIndex;
+    nodes[leftIndex + 1].parent = nodeIndex;
+    build(leftIndex, first, leftCount, order, boxes, maxLeafSize, depth + 1);
+    build(leftIndex + 1, first + leftCount, count - leftCount, order, boxes, maxLeafSize, depth + 1);
+}
+
+std::vector<Obstacle*> BVHLookup::findOverlapping(Point sender, Point receiver) const
+{
+    std::vector<Obstacle*> overlappingObstacles;
+    findOverlapping(sender, receiver, overlappingObstacles);
+    return overlappingObstacles;
+}
+
+void BVHLookup::findOverlapping(Point sender, Point receiver, std::vector<Obstacle*>& result) const
+{
+    result.clear();
+    if (root == noNode) return;
+
+    const Box bbox{
+        {std::min(sender.x, receiver.x), std::min(sender.y, receiver.y)},
+        {std::max(sender.x, receiver.x), std::max(sender.y, receiver.y)},
+    };
+
+    // precompute transmission ray properties
+    const Ray ray = makeRay(sender, receiver);
+    // sender and receiver coincide: there is no ray to intersect with
+    if (!(ray.length > 0)) return;
+
+    // depth-first traversal (insert() can make the tree arbitrarily deep, so the stack is reused rather than fixed)
+    thread_local std::vector<uint32_t> stack;
+    stack.clear();
+    stack.push_back(root);
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+        if (!overlaps(node.box, bbox) || !intersects(ray, node.box)) continue;
+        if (node.count == 0) {
+            stack.push_back(node.second);
+            stack.push_back(node.first);
+            continue;
+        }
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const Box& current = bboxes[i];
+            if (!overlaps(current, bbox)) continue;
+            if (!intersects(ray, current)) continue;
+            result.push_back(obstacleLookup[i]);
+        }
+    }
+}
+
+void BVHLookup::write(BinaryWriter& out, const std::vector<Obstacle*>& obstacles) const
+{
+    out.writeArray(nodes);
+    out.write<uint32_t>(root);
+    out.writeArray(bboxes);
+    out.writeArray(obstacleindices::toIndices(obstacleLookup, obstacles));
+}
+
+BVHLookup BVHLookup::read(BinaryReader& in, const std::vector<Obstacle*>& obstacles)
+{
+    BVHLookup lookup;
+    in.readArray(lookup.nodes);
+    lookup.root = in.read<uint32_t>();
+    in.readArray(lookup.bboxes);
+    std::vector<uint32_t> indices;
+    in.readArray(indices);
+    lookup.obstacleLookup = obstacleindices::toPointers(indices, obstacles);
+    if ((lookup.root != noNode && lookup.root >= lookup.nodes.size()) || lookup.obstacleLookup.size() != lookup.bboxes.size()) {
+        throw cRuntimeError("Stored BVHLookup is inconsistent");
+    }
+    // every index of a reachable node is used without further checks by findOverlapping; parent links must match, so the tree has no cycles
+    if (lookup.root != noNode) {
+        if (lookup.nodes[lookup.root].parent != noNode) {
+            throw cRuntimeError("Stored BVHLookup root has a parent");
+        }
+        std::vector<uint32_t> stack{lookup.root};
+        while (!stack.empty()) {
+            const uint32_t index = stack.back();
+            stack.pop_back();
+            const Node& node = lookup.nodes[index];
+            if (node.count > 0) {
+                if (node.first > lookup.bboxes.size() || node.count > lookup.bboxes.size() - node.first) {
+                    throw cRuntimeError("Stored BVHLookup leaf %u refers to bboxes beyond the %u stored", index, static_cast<unsigned>(lookup.bboxes.size()));
+                }
+                continue;
+            }
+            for (uint32_t child : {node.first, node.second}) {
+                if (child >= lookup.nodes.size() || lookup.nodes[child].parent != index || node.first == node.second) {
+                    throw cRuntimeError("Stored BVHLookup node %u has an invalid child %u", index, child);
+                }
+                stack.push_back(child);
+            }
+        }
+    }
+    for (uint32_t i = 0; i < lookup.obstacleLookup.size(); ++i) {
+        if (lookup.obstacleLookup[i]) lookup.indexByObstacle[lookup.obstacleLookup[i]] = i;
+    }
+    return lookup;
+}
+
+} // namespace veins
@@ -0,0 +1,120 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/modules/utility/BBoxLookup.h"
+
+namespace veins {
+
+class Obstacle;
+class BinaryReader;
+class BinaryWriter;
+
+/**
+ * Bounding volume hierarchy to find obstacles (geometric shapes) whose bounding box is crossed by a ray.
+ *
+ * Alternative to BBoxLookup that adapts to the density of obstacles:
+ * dense downtown areas get deep subtrees, while empty areas cost a single box test.
+ * Built top-down, splitting along the wider axis where the surface area heuristic (SAH) estimates the cheapest traversal.
+ *
+ * Like BBoxLookup, only considers the x and y coordinates and does not manage the lifetime of obstacles.
+ */
+class VEINS_API BVHLookup {
+public:
+    using Point = BBoxLookup::Point;
+    using Box = BBoxLookup::Box;
+
+    BVHLookup() = default;
+    BVHLookup(const std::vector<Obstacle*>& obstacles, std::function<Box(Obstacle*)> makeBBox, size_t maxLeafSize = 4);
+
+    /**
+     * Return all obstacles which have their bounding box touched by the transmission from sender to receiver.
+     *
+     * The obstacles itself may not actually overlap with transmission (false positives are possible).
+     * Each obstacle is returned only once.
+     */
+    std::vector<Obstacle*> findOverlapping(Point sender, Point receiver) const;
+
+    /**
+     * Same as findOverlapping(Point, Point), but reuses the memory of result (which is cleared first).
+     */
+    void findOverlapping(Point sender, Point receiver, std::vector<Obstacle*>& result) const;
+
+    /**
+     * Add an obstacle with the given bounding box as a new leaf next to the node whose box it enlarges least.
+     *
+     * Only touches the nodes on the path from the root to this leaf.
+     * Many insertions degrade the tree, so rebuild it after bulk changes.
+     */
+    void insert(Obstacle* obstacle, const Box& bbox);
+
+    /**
+     * Remove an obstacle (added at construction or by insert), only touching its entry.
+     *
+     * Boxes of its ancestors are not shrunk, which is conservative.
+     * Does nothing if the obstacle is not stored.
+     */
+    void remove(Obstacle* obstacle);
+
+    /**
+     * Write this lookup to out, referring to obstacles by their index in obstacles (which must hold all stored obstacles).
+     */
+    void write(BinaryWriter& out, const std::vector<Obstacle*>& obstacles) const;
+
+    /**
+     * Read a lookup written by write(), given the same obstacles in the same order.
+     */
+    static BVHLookup read(BinaryReader& in, const std::vector<Obstacle*>& obstacles);
+
+private:
+    static const uint32_t noNode = UINT32_MAX;
+
+    struct Node {
+        Box box; /**< bounding box of all obstacles in this subtree */
+        uint32_t first; /**< leaf: index of the first obstacle in bboxes, inner node: index of the left child */
+        uint32_t count; /**< leaf: number of obstacles, inner node: 0 */
+        uint32_t second; /**< inner node: index of the right child */
+        uint32_t parent; /**< index of the parent node (or noNode for the root) */
+    };
+
+    /**
+     * Turn nodes[nodeIndex] into a subtree over the obstacles order[first] to order[first + count - 1], reordering them as needed.
+     */
+    void build(uint32_t nodeIndex, uint32_t first, uint32_t count, std::vector<uint32_t>& order, const std::vector<Box>& boxes, size_t maxLeafSize, size_t depth);
+
+    std::vector<Node> nodes;
+    uint32_t root = noNode;
+    std::vector<Box> bboxes; /**< bboxes of obstacles, ordered by leaf (obstacles added by insert() follow) */
+    std::vector<Obstacle*> obstacleLookup; /**< bboxes[i] belongs to instance in obstacleLookup[i] */
+    std::unordered_map<Obstacle*, uint32_t> indexByObstacle; /**< index into bboxes of stored obstacles */
+};
+
+} // namespace veins
@@ -0,0 +1,184 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * Writes values and arrays of plain data types to a stream, byte for byte in the host's representation.
+ *
+ * Files written this way are only meant to be read back (by BinaryReader) on the same kind of host, e.g., as a cache.
+ */
+class VEINS_API BinaryWriter {
+public:
+    explicit BinaryWriter(std::ostream& out)
+        : out(out)
+    {
+    }
+
+    template <typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be written");
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /**
+     * Write the number of values, followed by the values themselves.
+     */
+    template <typename T>
+    void writeArray(const std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be written");
+        write<uint64_t>(values.size());
+        out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    void writeString(const std::string& value)
+    {
+        write<uint64_t>(value.size());
+        out.write(value.data(), value.size());
+    }
+
+private:
+    std::ostream& out;
+};
+
+/**
+ * Reads values written by BinaryWriter from a range of memory (e.g., a MappedFile).
+ *
+ * Throws a cRuntimeError when reading past the end of the range.
+ */
+class VEINS_API BinaryReader {
+public:
+    BinaryReader(const char* begin, const char* end)
+        : pos(begin)
+        , end(end)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be read");
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    /**
+     * Replace the contents of values by an array written with BinaryWriter::writeArray.
+     */
+    template <typename T>
+    void readArray(std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be read");
+        const uint64_t size = read<uint64_t>();
+        if (size > static_cast<uint64_t>(end - pos) / sizeof(T)) {
+            throw cRuntimeError("Binary data ends within an array of %llu elements", static_cast<unsigned long long>(size));
+        }
+        values.resize(size);
+        std::memcpy(values.data(), take(size * sizeof(T)), size * sizeof(T));
+    }
+
+    std::string readString()
+    {
+        const uint64_t size = read<uint64_t>();
+        if (size > static_cast<uint64_t>(end - pos)) {
+            throw cRuntimeError("Binary data ends within a string of %llu characters", static_cast<unsigned long long>(size));
+        }
+        return std::string(take(size), size);
+    }
+
+    bool atEnd() const
+    {
+        return pos == end;
+    }
+
+private:
+    /**
+     * Return the next size bytes and move past them.
+     */
+    const char* take(size_t size)
+    {
+        if (size > static_cast<size_t>(end - pos)) {
+            throw cRuntimeError("Binary data ends %llu bytes early", static_cast<unsigned long long>(size - static_cast<size_t>(end - pos)));
+        }
+        const char* begin = pos;
+        pos += size;
+        return begin;
+    }
+
+    const char* pos;
+    const char* end;
+};
+
+/**
+ * 64 bit FNV-1a hash of a sequence of values, e.g., to tell whether the inputs of a cached result changed.
+ */
+class VEINS_API ContentHash {
+public:
+    void add(const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    }
+
+    template <typename T>
+    void add(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain data can be hashed by value");
+        add(&value, sizeof(T));
+    }
+
+    /**
+     * Add a string, including its length (so "ab", "c" and "a", "bc" differ).
+     */
+    void add(const std::string& value)
+    {
+        add<uint64_t>(value.size());
+        add(value.data(), value.size());
+    }
+
+    uint64_t get() const
+    {
+        return hash;
+    }
+
+private:
+    uint64_t hash = 0xcbf29ce484222325ULL;
+};
+
+} // namespace veins
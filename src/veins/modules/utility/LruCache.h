@@ -0,0 +1,167 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * Fixed-capacity map that evicts its least recently used entry when full.
+ *
+ * Lookups and insertions take constant time on average.
+ * Counts hits and misses of find() to judge whether caching pays off.
+ * Not thread-safe; callers sharing an instance must synchronize access.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    /**
+     * Create a cache holding up to capacity entries (0 disables caching).
+     */
+    explicit LruCache(size_t capacity = 0)
+        : capacity(capacity)
+    {
+    }
+
+    /**
+     * Return a pointer to the value cached for key (or nullptr) and mark it as most recently used.
+     *
+     * The pointer stays valid until the entry is evicted or the cache is cleared.
+     */
+    const Value* find(const Key& key)
+    {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            misses++;
+            return nullptr;
+        }
+        hits++;
+        entries.splice(entries.begin(), entries, it->second);
+        return &it->second->second;
+    }
+
+    /**
+     * Cache value for key, evicting the least recently used entry if the cache is full.
+     */
+    void insert(const Key& key, Value value)
+    {
+        if (capacity == 0) return;
+        auto it = index.find(key);
+        if (it != index.end()) {
+            it->second->second = std::move(value);
+            entries.splice(entries.begin(), entries, it->second);
+            return;
+        }
+        if (entries.size() >= capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(key, std::move(value));
+        index.emplace(key, entries.begin());
+    }
+
+    /**
+     * Remove all entries for which pred(key, value) returns true.
+     *
+     * @return the number of removed entries
+     */
+    template <typename Predicate>
+    size_t eraseIf(Predicate pred)
+    {
+        size_t removed = 0;
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (pred(it->first, it->second)) {
+                index.erase(it->first);
+                it = entries.erase(it);
+                ++removed;
+            }
+            else {
+                ++it;
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * Remove all entries, keeping the statistics.
+     */
+    void clear()
+    {
+        index.clear();
+        entries.clear();
+    }
+
+    /**
+     * Change the capacity, evicting least recently used entries as needed.
+     */
+    void setCapacity(size_t newCapacity)
+    {
+        capacity = newCapacity;
+        while (entries.size() > capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+    size_t getCapacity() const
+    {
+        return capacity;
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    /** @brief number of calls to find() that returned a value */
+    uint64_t getHits() const
+    {
+        return hits;
+    }
+
+    /** @brief number of calls to find() that returned nullptr */
+    uint64_t getMisses() const
+    {
+        return misses;
+    }
+
+private:
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    size_t capacity;
+    Entries entries; /**< most recently used first */
+    std::unordered_map<Key, typename Entries::iterator, Hash> index;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+} // namespace veins
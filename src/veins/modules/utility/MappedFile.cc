@@ -0,0 +1,87 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/modules/utility/MappedFile.h"
+
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace veins {
+
+#ifndef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat info;
+    if (::fstat(fd, &info) == 0) {
+        size = static_cast<size_t>(info.st_size);
+        if (size == 0) {
+            open = true;
+        }
+        else {
+            void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if (address != MAP_FAILED) {
+                data = static_cast<const char*>(address);
+                mapped = true;
+                open = true;
+            }
+        }
+    }
+    // the mapping stays valid after closing the file
+    ::close(fd);
+    if (!open) size = 0;
+}
+
+MappedFile::~MappedFile()
+{
+    if (mapped) ::munmap(const_cast<char*>(data), size);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return;
+    buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    data = buffer.data();
+    size = buffer.size();
+    open = true;
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+#endif
+
+} // namespace veins
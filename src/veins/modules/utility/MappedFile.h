@@ -0,0 +1,73 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * Read-only view of the contents of a file.
+ *
+ * Where supported, the file is memory-mapped, so pages are only read when accessed and are shared by all processes mapping the same file.
+ * Otherwise, the file is read into memory.
+ */
+class VEINS_API MappedFile {
+public:
+    /**
+     * Map the file at path. Check isOpen() to see whether this succeeded (e.g., whether the file exists).
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const
+    {
+        return open;
+    }
+
+    const char* begin() const
+    {
+        return data;
+    }
+
+    const char* end() const
+    {
+        return data + size;
+    }
+
+private:
+    bool open = false;
+    const char* data = nullptr;
+    size_t size = 0;
+    bool mapped = false; /**< whether data is a memory mapping (or points into buffer) */
+    std::vector<char> buffer;
+};
+
+} // namespace veins
@@ -0,0 +1,85 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+class Obstacle;
+
+/**
+ * Helpers for BBoxLookup and BVHLookup to store references to obstacles as indices into the list of obstacles given to write() and read().
+ */
+namespace obstacleindices {
+
+const uint32_t noObstacle = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Replace each obstacle in lookup by its index in obstacles (nullptr by noObstacle).
+ */
+inline std::vector<uint32_t> toIndices(const std::vector<Obstacle*>& lookup, const std::vector<Obstacle*>& obstacles)
+{
+    std::unordered_map<Obstacle*, uint32_t> indices;
+    for (uint32_t i = 0; i < obstacles.size(); ++i) indices[obstacles[i]] = i;
+    std::vector<uint32_t> result;
+    result.reserve(lookup.size());
+    for (auto obstacle : lookup) {
+        if (!obstacle) {
+            result.push_back(noObstacle);
+            continue;
+        }
+        auto it = indices.find(obstacle);
+        ASSERT(it != indices.end());
+        result.push_back(it->second);
+    }
+    return result;
+}
+
+/**
+ * Inverse of toIndices.
+ */
+inline std::vector<Obstacle*> toPointers(const std::vector<uint32_t>& indices, const std::vector<Obstacle*>& obstacles)
+{
+    std::vector<Obstacle*> result;
+    result.reserve(indices.size());
+    for (auto index : indices) {
+        if (index == noObstacle) {
+            result.push_back(nullptr);
+            continue;
+        }
+        if (index >= obstacles.size()) {
+            throw cRuntimeError("Stored obstacle index %u exceeds the %u obstacles given", index, static_cast<unsigned>(obstacles.size()));
+        }
+        result.push_back(obstacles[index]);
+    }
+    return result;
+}
+
+} // namespace obstacleindices
+} // namespace veins
@@ -0,0 +1,118 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * FIFO queue stored in one contiguous, circular buffer.
+ *
+ * Pushing and popping never allocate unless the buffer is full, in which case its capacity doubles.
+ * Queues with a known maximum length should reserve() it up front so they never allocate at all.
+ */
+template <typename T>
+class RingBuffer {
+public:
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    size_t capacity() const
+    {
+        return slots.size();
+    }
+
+    /**
+     * Make room for at least n elements (rounded up to the next power of two).
+     */
+    void reserve(size_t n)
+    {
+        if (n <= slots.size()) return;
+        size_t newCapacity = 1;
+        while (newCapacity < n) newCapacity *= 2;
+        std::vector<T> newSlots(newCapacity);
+        for (size_t i = 0; i < count; ++i) {
+            newSlots[i] = std::move(slots[(head + i) & (slots.size() - 1)]);
+        }
+        slots.swap(newSlots);
+        head = 0;
+    }
+
+    T& front()
+    {
+        ASSERT(count > 0);
+        return slots[head];
+    }
+
+    const T& front() const
+    {
+        ASSERT(count > 0);
+        return slots[head];
+    }
+
+    T& back()
+    {
+        ASSERT(count > 0);
+        return slots[(head + count - 1) & (slots.size() - 1)];
+    }
+
+    const T& back() const
+    {
+        ASSERT(count > 0);
+        return slots[(head + count - 1) & (slots.size() - 1)];
+    }
+
+    void push(T value)
+    {
+        if (count == slots.size()) reserve(count == 0 ? 4 : 2 * count);
+        slots[(head + count) & (slots.size() - 1)] = std::move(value);
+        ++count;
+    }
+
+    void pop()
+    {
+        ASSERT(count > 0);
+        slots[head] = T();
+        head = (head + 1) & (slots.size() - 1);
+        --count;
+    }
+
+private:
+    std::vector<T> slots; /**< capacity is zero or a power of two */
+    size_t head = 0; /**< index of the front element */
+    size_t count = 0;
+};
+
+} // namespace veins
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 
+using omnetpp::SimTime;
 using omnetpp::simTime;
 using omnetpp::simtime_t;
 using veins::TimerManager;
@@ -160,8 +161,22 @@ omnetpp::simtime_t TimerSpecification::next()
     return next_absolute;
 }
 
-TimerManager::TimerManager(omnetpp::cSimpleModule* parent)
+namespace {
+
+// slots of 1 ms (or one time unit, if coarser), so that a wheel of 1024 slots covers about one second per revolution
+int64_t wheelSlotLength()
+{
+    return std::max<int64_t>(1, SimTime::getScale() / 1000);
+}
+
+const size_t wheelNumSlots = 1024;
+
+} // namespace
+
+TimerManager::TimerManager(omnetpp::cSimpleModule* parent, Backend backend)
     : parent_(parent)
+    , backend_(backend)
+    , wheel_(wheelSlotLength(), backend == Backend::timingWheel ? wheelNumSlots : 1)
 {
     ASSERT(parent_);
 }
@@ -171,10 +186,18 @@ TimerManager::~TimerManager()
     for (const auto& timer : timers_) {
         parent_->cancelAndDelete(timer.first);
     }
+    if (wheelMessage_) {
+        parent_->cancelAndDelete(wheelMessage_);
+    }
 }
 
 bool TimerManager::handleMessage(omnetpp::cMessage* message)
 {
+    if (message == wheelMessage_) {
+        handleWheelMessage();
+        return true;
+    }
+
     auto* timerMessage = dynamic_cast<TimerMessage*>(message);
     if (!timerMessage) {
         return false;
@@ -209,6 +232,17 @@ TimerManager::TimerHandle TimerManager::create(TimerSpecification timerSpecifica
     ASSERT(timerSpecification.valid());
     timerSpecification.finalize();
 
+    if (backend_ == Backend::timingWheel) {
+        if (timerSpecification.start_ < simTime()) {
+            throw omnetpp::cRuntimeError("TimerManager: cannot start timer in the past (t=%s)", timerSpecification.start_.str().c_str());
+        }
+        const auto handle = nextHandle_++;
+        wheel_.insert(timerSpecification.start_.raw(), handle);
+        wheelTimers_.emplace(handle, std::move(timerSpecification));
+        scheduleWheelMessage();
+        return handle;
+    }
+
     const auto ret = timers_.insert(std::make_pair(new TimerMessage(name), std::move(timerSpecification)));
     ASSERT(ret.second);
     parent_->scheduleAt(ret.first->second.start_, ret.first->first);
@@ -218,6 +252,17 @@ TimerManager::TimerHandle TimerManager::create(TimerSpecification timerSpecifica
 
 void TimerManager::cancel(TimerManager::TimerHandle handle)
 {
+    if (backend_ == Backend::timingWheel) {
+        if (handle == firingHandle_) {
+            // do not destroy the callback that is currently executing, handleWheelMessage erases the timer once it returns
+            firingCancelled_ = true;
+            return;
+        }
+        // the timer's entry in the wheel goes stale and is skipped when it comes due
+        wheelTimers_.erase(handle);
+        return;
+    }
+
     const auto entryMatchesHandle = [handle](const std::pair<TimerMessage*, TimerSpecification>& entry) { return entry.first->getId() == handle; };
     auto timer = std::find_if(timers_.begin(), timers_.end(), entryMatchesHandle);
     if (timer != timers_.end()) {
@@ -225,3 +270,53 @@ void TimerManager::cancel(TimerManager::TimerHandle handle)
         timers_.erase(timer);
     }
 }
+
+void TimerManager::handleWheelMessage()
+{
+    const auto now = simTime().raw();
+    while (!wheel_.empty() && wheel_.nextTime() <= now) {
+        const auto handle = wheel_.pop().second;
+        auto timer = wheelTimers_.find(handle);
+        if (timer == wheelTimers_.end()) {
+            continue; // cancelled
+        }
+        // elements of an unordered_map stay in place even if the callback creates further timers
+        auto& timerSpecification = timer->second;
+        ASSERT(timerSpecification.valid() && timerSpecification.validOccurence(simTime()));
+
+        firingHandle_ = handle;
+        firingCancelled_ = false;
+        timerSpecification.callback_(handle);
+        firingHandle_ = -1;
+
+        const auto nextEvent = firingCancelled_ ? simtime_t(-1) : timerSpecification.next();
+        if (nextEvent < 0) {
+            wheelTimers_.erase(handle);
+        }
+        else {
+            wheel_.insert(nextEvent.raw(), handle);
+        }
+    }
+    scheduleWheelMessage();
+}
+
+void TimerManager::scheduleWheelMessage()
+{
+    if (!wheelMessage_) {
+        // created on first use (rather than in the constructor) so that it is owned by the parent module
+        wheelMessage_ = new TimerMessage("timers");
+    }
+    if (wheel_.empty()) {
+        parent_->cancelEvent(wheelMessage_);
+        return;
+    }
+    simtime_t next;
+    next.setRaw(wheel_.nextTime());
+    if (wheelMessage_->isScheduled()) {
+        if (wheelMessage_->getArrivalTime() <= next) {
+            return;
+        }
+        parent_->cancelEvent(wheelMessage_);
+    }
+    parent_->scheduleAt(next, wheelMessage_);
+}
@@ -24,8 +24,10 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include "veins/veins.h"
+#include "veins/modules/utility/TimingWheel.h"
 
 namespace veins {
 
@@ -37,6 +39,9 @@ namespace veins {
  *
  * In order to schedule a timer, create a TimerSpecification object using the corresponding methods.
  * After configuration, use the create function from the TimerManager to actually schedule the configured timer.
+ *
+ * By default, every timer is backed by a self-message of its own.
+ * Modules running many timers can instead use the timing wheel backend, which keeps all timers in a module-local timing wheel and only schedules the earliest deadline with the simulation kernel.
  */
 class TimerManager;
 
@@ -220,7 +225,12 @@ public:
     using TimerList = std::map<TimerMessage*, TimerSpecification>;
     using TimerHandle = long;
 
-    TimerManager(omnetpp::cSimpleModule* parent);
+    enum class Backend {
+        message, ///< schedule one self-message per timer
+        timingWheel ///< keep all timers in a TimingWheel, scheduling one self-message for the earliest deadline
+    };
+
+    TimerManager(omnetpp::cSimpleModule* parent, Backend backend = Backend::message);
 
     /**
      * Destroy this module.
@@ -241,7 +251,7 @@ public:
      * Create a new timer.
      *
      * @param timerSpecification Parameters for the new timer
-     * @param name The timer's name
+     * @param name The timer's name (used for its self-message, ignored by the timing wheel backend)
      * @return A handle for the timer.
      *
      * @see cancel
@@ -259,8 +269,26 @@ public:
     void cancel(TimerHandle handle);
 
 private:
-    TimerList timers_; ///< List of all active Timers.
+    /**
+     * Trigger all timers of the timing wheel backend that are due now.
+     */
+    void handleWheelMessage();
+
+    /**
+     * (Re-)schedule the self-message of the timing wheel backend for the earliest deadline in the wheel.
+     */
+    void scheduleWheelMessage();
+
+    TimerList timers_; ///< List of all active Timers (message backend).
     omnetpp::cSimpleModule* const parent_; ///< A pointer to the module which owns this TimerManager.
+    const Backend backend_;
+
+    std::unordered_map<TimerHandle, TimerSpecification> wheelTimers_; ///< All active Timers (timing wheel backend).
+    TimingWheel<TimerHandle> wheel_; ///< Next occurence of every timer in wheelTimers_, plus stale entries of cancelled timers.
+    TimerMessage* wheelMessage_ = nullptr; ///< Self-message scheduled for the earliest deadline in wheel_.
+    TimerHandle nextHandle_ = 0;
+    TimerHandle firingHandle_ = -1; ///< Timer whose callback is currently executing.
+    bool firingCancelled_ = false; ///< Whether the timer identified by firingHandle_ was cancelled by its own callback.
 };
 
 } // namespace veins
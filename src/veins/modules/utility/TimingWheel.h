@@ -0,0 +1,148 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * Hashed timing wheel: a priority queue of values keyed by (integer) time.
+ *
+ * Values are sorted into numSlots buckets of slotLength time units each; a value due k revolutions later shares a bucket with values due now.
+ * Inserting is O(1); a bucket is only sorted once the cursor reaches it, so the cost of ordering grows with the number of values due in one slot rather than with the total number of values.
+ * Values due at the same time are popped in insertion order.
+ */
+template <typename T>
+class TimingWheel {
+public:
+    TimingWheel(int64_t slotLength, size_t numSlots)
+        : slotLength(slotLength)
+        , slots(numSlots)
+    {
+        ASSERT(slotLength > 0);
+        ASSERT(numSlots > 0);
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * Add value, due at time (which must not be negative).
+     */
+    void insert(int64_t time, T value)
+    {
+        ASSERT(time >= 0);
+        int64_t slot = time / slotLength;
+        if (count == 0 || slot < cursor) {
+            cursor = slot;
+            sortedSlot = -1;
+        }
+        else if (sortedSlot != -1 && slot % slots.size() == sortedSlot % slots.size()) {
+            sortedSlot = -1;
+        }
+        slots[slot % slots.size()].push_back({time, nextSequence++, std::move(value)});
+        ++count;
+    }
+
+    /**
+     * Return the earliest time any value is due at. Must not be empty.
+     */
+    int64_t nextTime()
+    {
+        return nextEntry().time;
+    }
+
+    /**
+     * Remove and return the value due first. Must not be empty.
+     */
+    std::pair<int64_t, T> pop()
+    {
+        Entry& entry = nextEntry();
+        std::pair<int64_t, T> result(entry.time, std::move(entry.value));
+        slots[cursor % slots.size()].pop_back();
+        --count;
+        return result;
+    }
+
+private:
+    struct Entry {
+        int64_t time;
+        uint64_t sequence;
+        T value;
+    };
+
+    /** @brief advance the cursor to the slot of the earliest entry and return it; it is the back of its (sorted) bucket */
+    Entry& nextEntry()
+    {
+        ASSERT(count > 0);
+        for (size_t scanned = 0;; ++scanned) {
+            if (scanned == slots.size()) {
+                // nothing due within a whole revolution: jump to the earliest entry instead of scanning on
+                int64_t earliest = -1;
+                for (auto& bucket : slots) {
+                    for (auto& entry : bucket) {
+                        if (earliest == -1 || entry.time < earliest) earliest = entry.time;
+                    }
+                }
+                cursor = earliest / slotLength;
+                sortedSlot = -1;
+                scanned = 0;
+            }
+            auto& bucket = slots[cursor % slots.size()];
+            if (!bucket.empty()) {
+                if (sortedSlot != cursor) {
+                    // sort latest first, so the earliest entry can be popped off the back
+                    std::sort(bucket.begin(), bucket.end(), [](const Entry& a, const Entry& b) {
+                        return a.time != b.time ? a.time > b.time : a.sequence > b.sequence;
+                    });
+                    sortedSlot = cursor;
+                }
+                if (bucket.back().time / slotLength == cursor) return bucket.back();
+            }
+            ++cursor;
+        }
+    }
+
+    int64_t slotLength;
+    std::vector<std::vector<Entry>> slots;
+    int64_t cursor = 0; /**< absolute number of the slot no entry is due before */
+    int64_t sortedSlot = -1; /**< absolute number of the slot whose bucket is known to be sorted */
+    size_t count = 0;
+    uint64_t nextSequence = 0;
+};
+
+} // namespace veins
@@ -74,5 +74,38 @@ SCENARIO("Using AntennaPosition", "[toolbox]")
                 REQUIRE(p.isSameAntenna(p2) == false);
             }
         }
+
+        WHEN("compared with the same antenna, moving the same way from a later time")
+        {
+            auto p2 = AntennaPosition(hostA, posA, speedA, SimTime(1, SIMTIME_S));
+            THEN("it is found to be in a different state")
+            {
+                REQUIRE(p.isSameState(p2) == false);
+                REQUIRE(p.isSameState(AntennaPosition(hostA, posA, speedA, timeA)) == true);
+            }
+        }
+    }
+
+    GIVEN("An AntennaPosition standing still at (1, 0, 0) since 0")
+    {
+        auto p = AntennaPosition(1, Coord(1, 0, 0), Coord(0, 0, 0), SimTime(0, SIMTIME_S));
+
+        WHEN("compared with the same antenna at the same position since a later time")
+        {
+            auto p2 = AntennaPosition(1, Coord(1, 0, 0), Coord(0, 0, 0), SimTime(1, SIMTIME_S));
+            THEN("it is found to be in the same state")
+            {
+                REQUIRE(p.isSameState(p2) == true);
+            }
+        }
+
+        WHEN("compared with the same antenna at a different position")
+        {
+            auto p2 = AntennaPosition(1, Coord(2, 0, 0), Coord(0, 0, 0), SimTime(0, SIMTIME_S));
+            THEN("it is found to be in a different state")
+            {
+                REQUIRE(p.isSameState(p2) == false);
+            }
+        }
     }
 }
@@ -0,0 +1,138 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include "veins/modules/utility/BBoxLookup.h"
+
+using namespace veins;
+
+namespace {
+
+// obstacles are only handled as opaque pointers, so point them at their bounding boxes
+std::vector<Obstacle*> asObstacles(std::vector<BBoxLookup::Box>& boxes)
+{
+    std::vector<Obstacle*> obstacles;
+    for (auto& box : boxes) obstacles.push_back(reinterpret_cast<Obstacle*>(&box));
+    return obstacles;
+}
+
+BBoxLookup::Box boxOf(Obstacle* o)
+{
+    return *reinterpret_cast<BBoxLookup::Box*>(o);
+}
+
+bool overlapsSegment(const BBoxLookup::Box& box, BBoxLookup::Point a, BBoxLookup::Point b)
+{
+    // sample the segment densely; good enough for boxes that are not grazed
+    for (int i = 0; i <= 10000; ++i) {
+        double t = i / 10000.0;
+        double x = a.x + (b.x - a.x) * t;
+        double y = a.y + (b.y - a.y) * t;
+        if (x > box.p1.x && x < box.p2.x && y > box.p1.y && y < box.p2.y) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+SCENARIO("BBoxLookup", "[bboxlookup]")
+{
+    GIVEN("an obstacle spanning several cells")
+    {
+        std::vector<BBoxLookup::Box> boxes{{{10, 10}, {90, 20}}, {{50, 50}, {60, 60}}};
+        auto obstacles = asObstacles(boxes);
+        BBoxLookup lookup(obstacles, boxOf, 100, 100, 10);
+        WHEN("a ray crosses it in several cells")
+        {
+            auto found = lookup.findOverlapping({5, 15}, {95, 15});
+            THEN("it is reported once")
+            {
+                REQUIRE(found.size() == 1);
+                REQUIRE(found[0] == obstacles[0]);
+            }
+        }
+        WHEN("a ray passes next to all obstacles")
+        {
+            auto found = lookup.findOverlapping({5, 95}, {95, 70});
+            THEN("nothing is reported")
+            {
+                REQUIRE(found.empty());
+            }
+        }
+        WHEN("a ray crosses both obstacles diagonally")
+        {
+            auto found = lookup.findOverlapping({0, 0}, {100, 100});
+            THEN("both are reported in the order they are crossed")
+            {
+                REQUIRE(found.size() == 2);
+                REQUIRE(found[0] == obstacles[0]);
+                REQUIRE(found[1] == obstacles[1]);
+            }
+        }
+        WHEN("a ray starts and ends outside the grid")
+        {
+            auto found = lookup.findOverlapping({-50, 55}, {150, 55});
+            THEN("obstacles inside the grid are reported")
+            {
+                REQUIRE(found.size() == 1);
+                REQUIRE(found[0] == obstacles[1]);
+            }
+        }
+    }
+    GIVEN("many random obstacles")
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> coordinate(0, 1000);
+        std::uniform_real_distribution<double> extent(1, 40);
+        std::vector<BBoxLookup::Box> boxes;
+        for (int i = 0; i < 200; ++i) {
+            double x = coordinate(rng);
+            double y = coordinate(rng);
+            boxes.push_back({{x, y}, {x + extent(rng), y + extent(rng)}});
+        }
+        auto obstacles = asObstacles(boxes);
+        BBoxLookup lookup(obstacles, boxOf, 1000, 1000, 50);
+        THEN("reused buffers find exactly the obstacles crossed by random rays, without duplicates")
+        {
+            std::vector<Obstacle*> found;
+            BBoxLookup::Mailbox mailbox;
+            for (int i = 0; i < 100; ++i) {
+                BBoxLookup::Point a{coordinate(rng), coordinate(rng)};
+                BBoxLookup::Point b{coordinate(rng), coordinate(rng)};
+                lookup.findOverlapping(a, b, found, mailbox);
+                auto sorted = found;
+                std::sort(sorted.begin(), sorted.end());
+                REQUIRE(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+                for (size_t j = 0; j < boxes.size(); ++j) {
+                    if (overlapsSegment(boxes[j], a, b)) {
+                        REQUIRE(std::count(found.begin(), found.end(), obstacles[j]) == 1);
+                    }
+                }
+            }
+        }
+    }
+}
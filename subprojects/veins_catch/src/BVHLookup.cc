@@ -0,0 +1,308 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <sstream>
+
+#include "veins/modules/utility/BBoxLookup.h"
+#include "veins/modules/utility/BVHLookup.h"
+#include "veins/modules/utility/BinaryStream.h"
+#include "testutils/ErlangenBuildings.h"
+
+using namespace veins;
+
+namespace {
+
+BBoxLookup::Box boxOf(Obstacle* o)
+{
+    return {{o->getBboxP1().x, o->getBboxP1().y}, {o->getBboxP2().x, o->getBboxP2().y}};
+}
+
+std::vector<Obstacle*> pointersTo(std::vector<Obstacle>& obstacles)
+{
+    std::vector<Obstacle*> pointers;
+    for (auto& o : obstacles) pointers.push_back(&o);
+    return pointers;
+}
+
+BBoxLookup::Point extentOf(const std::vector<Obstacle>& obstacles)
+{
+    BBoxLookup::Point extent{1, 1};
+    for (const auto& o : obstacles) {
+        extent.x = std::max(extent.x, o.getBboxP2().x);
+        extent.y = std::max(extent.y, o.getBboxP2().y);
+    }
+    return extent;
+}
+
+/**
+ * Random links of up to 500 m within the given extent.
+ */
+std::vector<std::pair<BBoxLookup::Point, BBoxLookup::Point>> randomLinks(BBoxLookup::Point extent, size_t count)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> x(0, extent.x);
+    std::uniform_real_distribution<double> y(0, extent.y);
+    std::uniform_real_distribution<double> offset(-500, 500);
+    std::vector<std::pair<BBoxLookup::Point, BBoxLookup::Point>> links;
+    for (size_t i = 0; i < count; ++i) {
+        BBoxLookup::Point sender{x(rng), y(rng)};
+        links.push_back({sender, {sender.x + offset(rng), sender.y + offset(rng)}});
+    }
+    return links;
+}
+
+} // namespace
+
+SCENARIO("BVHLookup", "[bvhlookup]")
+{
+    GIVEN("the buildings of the Erlangen scenario")
+    {
+        auto obstacles = loadErlangenBuildings();
+        REQUIRE(obstacles.size() > 100);
+        auto pointers = pointersTo(obstacles);
+        auto extent = extentOf(obstacles);
+
+        BBoxLookup grid(pointers, boxOf, extent.x, extent.y);
+        BVHLookup bvh(pointers, boxOf);
+
+        THEN("a BVH finds the same obstacles as the grid, each only once")
+        {
+            std::vector<Obstacle*> fromGrid;
+            std::vector<Obstacle*> fromBvh;
+            BBoxLookup::Mailbox mailbox;
+            size_t numFound = 0;
+            for (const auto& link : randomLinks(extent, 1000)) {
+                grid.findOverlapping(link.first, link.second, fromGrid, mailbox);
+                bvh.findOverlapping(link.first, link.second, fromBvh);
+                std::sort(fromGrid.begin(), fromGrid.end());
+                std::sort(fromBvh.begin(), fromBvh.end());
+                REQUIRE(std::adjacent_find(fromBvh.begin(), fromBvh.end()) == fromBvh.end());
+                REQUIRE(fromBvh == fromGrid);
+                numFound += fromBvh.size();
+            }
+            REQUIRE(numFound > 0);
+        }
+    }
+    GIVEN("indexes written to binary data")
+    {
+        auto obstacles = loadErlangenBuildings();
+        auto pointers = pointersTo(obstacles);
+        auto extent = extentOf(obstacles);
+        BBoxLookup grid(pointers, boxOf, extent.x, extent.y);
+        BVHLookup bvh(pointers, boxOf);
+
+        std::ostringstream stream;
+        BinaryWriter out(stream);
+        grid.write(out, pointers);
+        bvh.write(out, pointers);
+        const std::string data = stream.str();
+
+        WHEN("they are read back for a copy of the obstacles")
+        {
+            auto copies = obstacles;
+            auto copyPointers = pointersTo(copies);
+            BinaryReader in(data.data(), data.data() + data.size());
+            BBoxLookup readGrid = BBoxLookup::read(in, copyPointers);
+            BVHLookup readBvh = BVHLookup::read(in, copyPointers);
+            REQUIRE(in.atEnd());
+
+            THEN("they find the copies of the obstacles found by the original indexes")
+            {
+                std::vector<Obstacle*> found;
+                std::vector<Obstacle*> foundRead;
+                BBoxLookup::Mailbox mailbox;
+                auto indicesIn = [](const std::vector<Obstacle*>& found, const std::vector<Obstacle*>& pointers) {
+                    std::vector<size_t> indices;
+                    for (auto o : found) indices.push_back(std::find(pointers.begin(), pointers.end(), o) - pointers.begin());
+                    std::sort(indices.begin(), indices.end());
+                    return indices;
+                };
+                for (const auto& link : randomLinks(extent, 200)) {
+                    grid.findOverlapping(link.first, link.second, found, mailbox);
+                    readGrid.findOverlapping(link.first, link.second, foundRead, mailbox);
+                    REQUIRE(indicesIn(foundRead, copyPointers) == indicesIn(found, pointers));
+                    bvh.findOverlapping(link.first, link.second, found);
+                    readBvh.findOverlapping(link.first, link.second, foundRead);
+                    REQUIRE(indicesIn(foundRead, copyPointers) == indicesIn(found, pointers));
+                }
+            }
+        }
+        WHEN("the data is truncated")
+        {
+            BinaryReader in(data.data(), data.data() + data.size() / 2);
+            THEN("reading fails")
+            {
+                REQUIRE_THROWS(BBoxLookup::read(in, pointers));
+            }
+        }
+        WHEN("the first grid cell refers to more bboxes than stored")
+        {
+            // cellSize, numCols, numRows, numObstacles and the size of bboxCells precede the index and count of the first cell
+            std::string damaged = data;
+            const uint64_t count = 1ULL << 40;
+            std::memcpy(&damaged[sizeof(int32_t) + 4 * sizeof(uint64_t) + sizeof(size_t)], &count, sizeof(size_t));
+            BinaryReader in(damaged.data(), damaged.data() + damaged.size());
+            THEN("reading fails")
+            {
+                REQUIRE_THROWS(BBoxLookup::read(in, pointers));
+            }
+        }
+        WHEN("the root of the BVH refers to a child that does not exist")
+        {
+            std::ostringstream bvhStream;
+            BinaryWriter bvhOut(bvhStream);
+            bvh.write(bvhOut, pointers);
+            std::string damaged = bvhStream.str();
+            // the size of nodes and the bounding box of the root (node 0) precede the index of its first child
+            const uint32_t child = 1u << 30;
+            std::memcpy(&damaged[sizeof(uint64_t) + sizeof(BBoxLookup::Box)], &child, sizeof(child));
+            BinaryReader in(damaged.data(), damaged.data() + damaged.size());
+            THEN("reading fails")
+            {
+                REQUIRE_THROWS(BVHLookup::read(in, pointers));
+            }
+        }
+    }
+    GIVEN("indexes built from half of the Erlangen buildings")
+    {
+        auto obstacles = loadErlangenBuildings();
+        REQUIRE(obstacles.size() > 100);
+        auto pointers = pointersTo(obstacles);
+        auto extent = extentOf(obstacles);
+        std::vector<Obstacle*> initial(pointers.begin(), pointers.begin() + pointers.size() / 2);
+
+        BBoxLookup grid(initial, boxOf, extent.x, extent.y);
+        BVHLookup bvh(initial, boxOf);
+
+        WHEN("the other half is inserted and every third building removed")
+        {
+            std::vector<Obstacle*> expected;
+            for (size_t i = pointers.size() / 2; i < pointers.size(); ++i) {
+                grid.insert(pointers[i], boxOf(pointers[i]));
+                bvh.insert(pointers[i], boxOf(pointers[i]));
+            }
+            for (size_t i = 0; i < pointers.size(); ++i) {
+                if (i % 3 == 0) {
+                    grid.remove(pointers[i]);
+                    bvh.remove(pointers[i]);
+                }
+                else {
+                    expected.push_back(pointers[i]);
+                }
+            }
+            THEN("both find the same obstacles as indexes built from scratch")
+            {
+                BBoxLookup freshGrid(expected, boxOf, extent.x, extent.y);
+                std::vector<Obstacle*> fromGrid;
+                std::vector<Obstacle*> fromBvh;
+                std::vector<Obstacle*> fromFresh;
+                BBoxLookup::Mailbox mailbox;
+                for (const auto& link : randomLinks(extent, 1000)) {
+                    grid.findOverlapping(link.first, link.second, fromGrid, mailbox);
+                    bvh.findOverlapping(link.first, link.second, fromBvh);
+                    freshGrid.findOverlapping(link.first, link.second, fromFresh, mailbox);
+                    std::sort(fromGrid.begin(), fromGrid.end());
+                    std::sort(fromBvh.begin(), fromBvh.end());
+                    std::sort(fromFresh.begin(), fromFresh.end());
+                    REQUIRE(fromGrid == fromFresh);
+                    REQUIRE(fromBvh == fromFresh);
+                }
+            }
+        }
+    }
+    GIVEN("obstacles with identical bounding boxes")
+    {
+        std::vector<Obstacle> obstacles(20, Obstacle("o", "building", 9, 0.4));
+        for (auto& o : obstacles) o.setShape({{10, 10}, {20, 10}, {20, 20}, {10, 20}});
+        BVHLookup bvh(pointersTo(obstacles), boxOf, 2);
+        THEN("all are found")
+        {
+            REQUIRE(bvh.findOverlapping({0, 15}, {30, 15}).size() == obstacles.size());
+            REQUIRE(bvh.findOverlapping({0, 25}, {30, 25}).empty());
+        }
+    }
+    GIVEN("no obstacles")
+    {
+        BVHLookup bvh({}, boxOf);
+        THEN("nothing is found")
+        {
+            REQUIRE(bvh.findOverlapping({0, 0}, {10, 10}).empty());
+        }
+        WHEN("an obstacle is inserted")
+        {
+            Obstacle o("o", "building", 9, 0.4);
+            o.setShape({{2, 2}, {4, 2}, {4, 4}, {2, 4}});
+            bvh.insert(&o, boxOf(&o));
+            THEN("it is found")
+            {
+                REQUIRE(bvh.findOverlapping({0, 0}, {10, 10}).size() == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("Spatial index benchmark", "[.][benchmark]")
+{
+    auto obstacles = loadErlangenBuildings();
+    REQUIRE(obstacles.size() > 100);
+    auto pointers = pointersTo(obstacles);
+    auto extent = extentOf(obstacles);
+    auto links = randomLinks(extent, 1000);
+
+    BENCHMARK("build grid")
+    {
+        return BBoxLookup(pointers, boxOf, extent.x, extent.y);
+    };
+    BENCHMARK("build BVH")
+    {
+        return BVHLookup(pointers, boxOf);
+    };
+
+    BBoxLookup grid(pointers, boxOf, extent.x, extent.y);
+    BVHLookup bvh(pointers, boxOf);
+    std::vector<Obstacle*> result;
+    BBoxLookup::Mailbox mailbox;
+    BENCHMARK("1000 queries, grid")
+    {
+        size_t found = 0;
+        for (const auto& link : links) {
+            grid.findOverlapping(link.first, link.second, result, mailbox);
+            found += result.size();
+        }
+        return found;
+    };
+    BENCHMARK("1000 queries, BVH")
+    {
+        size_t found = 0;
+        for (const auto& link : links) {
+            bvh.findOverlapping(link.first, link.second, result);
+            found += result.size();
+        }
+        return found;
+    };
+}
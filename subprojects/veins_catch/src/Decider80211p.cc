@@ -0,0 +1,223 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "veins/base/utils/ThreadPool.h"
+#include "veins/modules/messages/AirFrame11p_m.h"
+#include "veins/modules/phy/Decider80211p.h"
+#include "veins/modules/phy/DeciderResult80211.h"
+#include "testutils/Simulation.h"
+#include "testutils/Component.h"
+
+using namespace veins;
+
+namespace {
+
+const double channelCenterFrequency = 5.89e9;
+
+/**
+ * PHY that reports a fixed set of AirFrames and a configurable far-field interference.
+ */
+class DummyPhy : public DeciderToPhyInterface, public Decider80211pToPhy80211pInterface {
+public:
+    void getChannelInfo(simtime_t_cref from, simtime_t_cref to, AirFrameVector& out) override
+    {
+        out = airFrames;
+    }
+    double getNoiseFloorValue() override
+    {
+        return 1e-10;
+    }
+    void sendControlMsgToMac(cMessage* msg) override
+    {
+        delete msg;
+    }
+    void sendUp(AirFrame* packet, DeciderResult* result) override
+    {
+    }
+    BaseWorldUtility* getWorldUtility() override
+    {
+        return nullptr;
+    }
+    void recordScalar(const char* name, double value, const char* unit = nullptr) override
+    {
+    }
+    int getCurrentRadioChannel() override
+    {
+        return 178;
+    }
+    int getRadioState() override
+    {
+        return 0;
+    }
+    double getFarFieldInterference(simtime_t_cref start, simtime_t_cref end, double centerFrequency) override
+    {
+        return farFieldInterference;
+    }
+
+    AirFrameVector airFrames;
+    double farFieldInterference = 0;
+};
+
+/**
+ * Decider80211p with parallelDecisions enabled and access to its evaluation in advance.
+ */
+class TestDecider : public Decider80211p {
+public:
+    TestDecider(cComponent* owner, DummyPhy* phy)
+        : Decider80211p(owner, phy, 1e-13, 1e-9, false, channelCenterFrequency, -1, true, true, 42)
+    {
+    }
+
+    using Decider80211p::checkIfSignalOk;
+    using Decider80211p::evaluateSignal;
+    using Decider80211p::evaluatedFrame;
+    using Decider80211p::evaluation;
+};
+
+std::unique_ptr<AirFrame11p> createFrame(double power_mW, simtime_t start, AnalogueModelList* analogueModels)
+{
+    Signal signal(Spectrum({channelCenterFrequency - 5e6, channelCenterFrequency, channelCenterFrequency + 5e6}), start, SimTime(500, SIMTIME_US));
+    for (uint16_t i = 0; i < signal.getNumValues(); ++i) signal.at(i) = power_mW;
+    signal.setDataStart(0);
+    signal.setDataEnd(2);
+    signal.setCenterFrequencyIndex(1);
+    signal.setAnalogueModelList(analogueModels);
+
+    auto frame = make_unique<AirFrame11p>();
+    frame->setSignal(signal);
+    frame->setMcs(static_cast<int>(MCS::ofdm_qpsk_r_1_2));
+    frame->setBitLength(800);
+    return frame;
+}
+
+DeciderResult80211* as80211(DeciderResult* result)
+{
+    auto result80211 = dynamic_cast<DeciderResult80211*>(result);
+    REQUIRE(result80211 != nullptr);
+    return result80211;
+}
+
+void requireSameResult(DeciderResult* a, DeciderResult* b)
+{
+    auto a80211 = as80211(a);
+    auto b80211 = as80211(b);
+    REQUIRE(a80211->isSignalCorrect() == b80211->isSignalCorrect());
+    REQUIRE(a80211->isCollision() == b80211->isCollision());
+    REQUIRE(a80211->getSnr() == b80211->getSnr());
+    REQUIRE(a80211->getBitrate() == b80211->getBitrate());
+}
+
+} // namespace
+
+SCENARIO("Decider80211p reuses evaluations computed in advance", "[decider]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    DummyComponent dc(&ds);
+    AnalogueModelList analogueModels;
+
+    // receptions near the decoding threshold, interfered by a weaker frame, so outcomes differ between frames
+    const size_t numReceptions = 32;
+    std::vector<std::unique_ptr<AirFrame11p>> frames;
+    std::vector<std::unique_ptr<DummyPhy>> phys;
+    for (size_t i = 0; i < numReceptions; ++i) {
+        frames.push_back(createFrame(3e-10 + 1e-11 * i, SimTime(1, SIMTIME_MS), &analogueModels));
+        frames.push_back(createFrame(1e-11, SimTime(1200, SIMTIME_US), &analogueModels));
+        phys.push_back(make_unique<DummyPhy>());
+        phys.back()->airFrames = {frames[2 * i].get(), frames[2 * i + 1].get()};
+        phys.back()->farFieldInterference = 1e-11;
+    }
+    auto frameOf = [&frames](size_t i) { return frames[2 * i].get(); };
+
+    GIVEN("receptions evaluated in advance on several threads")
+    {
+        std::vector<std::unique_ptr<TestDecider>> deciders;
+        for (size_t i = 0; i < numReceptions; ++i) deciders.push_back(make_unique<TestDecider>(&dc, phys[i].get()));
+
+        // as in evaluateReceptionsEndingNow()
+        ThreadPool pool(4);
+        pool.parallelFor(numReceptions, [&](size_t i) {
+            const Signal& signal = frameOf(i)->getSignal();
+            AirFrameVector airFrames;
+            phys[i]->getChannelInfo(signal.getReceptionStart(), signal.getReceptionEnd(), airFrames);
+            deciders[i]->evaluation = deciders[i]->evaluateSignal(frameOf(i), airFrames, phys[i]->farFieldInterference);
+        });
+        for (size_t i = 0; i < numReceptions; ++i) deciders[i]->evaluatedFrame = frameOf(i);
+
+        THEN("each decider delivers the same result as one evaluating serially")
+        {
+            for (size_t i = 0; i < numReceptions; ++i) {
+                TestDecider serial(&dc, phys[i].get());
+                std::unique_ptr<DeciderResult> expected(serial.checkIfSignalOk(frameOf(i)));
+                std::unique_ptr<DeciderResult> result(deciders[i]->checkIfSignalOk(frameOf(i)));
+                requireSameResult(result.get(), expected.get());
+                REQUIRE(deciders[i]->evaluatedFrame == nullptr);
+            }
+        }
+    }
+
+    GIVEN("a decider holding a made-up evaluation of a frame")
+    {
+        TestDecider decider(&dc, phys[0].get());
+        TestDecider serial(&dc, phys[0].get());
+        decider.evaluatedFrame = frameOf(0);
+        decider.evaluation = {-1, 1e6, phys[0]->farFieldInterference, Decider80211p::COLLISION};
+
+        WHEN("that frame ends and the far-field interference is unchanged")
+        {
+            std::unique_ptr<DeciderResult> result(decider.checkIfSignalOk(frameOf(0)));
+            THEN("the evaluation is used")
+            {
+                auto result80211 = as80211(result.get());
+                REQUIRE(result80211->getSnr() == -1);
+                REQUIRE(result80211->getBitrate() == 1e6);
+                REQUIRE(result80211->isCollision());
+            }
+        }
+        WHEN("that frame ends but the far-field interference has changed")
+        {
+            phys[0]->farFieldInterference *= 2;
+            std::unique_ptr<DeciderResult> result(decider.checkIfSignalOk(frameOf(0)));
+            THEN("the frame is evaluated again")
+            {
+                std::unique_ptr<DeciderResult> expected(serial.checkIfSignalOk(frameOf(0)));
+                requireSameResult(result.get(), expected.get());
+                REQUIRE(as80211(result.get())->getSnr() != -1);
+            }
+        }
+        WHEN("another frame ends")
+        {
+            decider.evaluatedFrame = frameOf(1);
+            std::unique_ptr<DeciderResult> result(decider.checkIfSignalOk(frameOf(0)));
+            THEN("that frame is evaluated on its own")
+            {
+                std::unique_ptr<DeciderResult> expected(serial.checkIfSignalOk(frameOf(0)));
+                requireSameResult(result.get(), expected.get());
+                REQUIRE(as80211(result.get())->getSnr() != -1);
+            }
+        }
+    }
+}
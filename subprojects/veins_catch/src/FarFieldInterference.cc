@@ -0,0 +1,126 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include <cmath>
+
+#include "veins/base/connectionManager/FarFieldInterference.h"
+#include "veins/base/modules/BaseWorldUtility.h"
+#include "testutils/Simulation.h"
+
+using namespace veins;
+
+namespace {
+
+const double frequency = 5.89e9;
+
+double powerAt1m(double txPower_mW)
+{
+    const double wavelength = BaseWorldUtility::speedOfLight() / frequency;
+    return txPower_mW * wavelength * wavelength / (16 * M_PI * M_PI);
+}
+
+} // namespace
+
+SCENARIO("FarFieldInterference aggregates distant transmissions", "[farfield]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    // near field 200 m, far field up to 2000 m, 10 m cells, 1 ms bins, free space
+    FarFieldInterference farField(200, 2000, 10, SimTime(1, SIMTIME_MS), SimTime(100, SIMTIME_MS), 2.0);
+
+    GIVEN("a single transmission of 20 mW lasting 2 ms from the center of a cell")
+    {
+        farField.addTransmission(Coord(1005, 5, 0), 20, frequency, SimTime(10, SIMTIME_MS), SimTime(2, SIMTIME_MS));
+
+        THEN("a distant receiver sees the free space power during the transmission")
+        {
+            double expected = powerAt1m(20) / (1000 * 1000);
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(10, SIMTIME_MS), SimTime(12, SIMTIME_MS)) == Approx(expected));
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(11, SIMTIME_MS), SimTime(11, SIMTIME_MS)) == Approx(expected));
+        }
+        THEN("the power is averaged over the requested interval")
+        {
+            double expected = powerAt1m(20) / (1000 * 1000) / 2;
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(11, SIMTIME_MS), SimTime(13, SIMTIME_MS)) == Approx(expected));
+        }
+        THEN("it is not seen before or after the transmission")
+        {
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(5, SIMTIME_MS), SimTime(10, SIMTIME_MS)) == 0);
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(12, SIMTIME_MS), SimTime(20, SIMTIME_MS)) == 0);
+        }
+        THEN("it is not seen within the near field, beyond the maximum distance, or on other channels")
+        {
+            REQUIRE(farField.getInterference(Coord(905, 5, 0), frequency, SimTime(10, SIMTIME_MS), SimTime(12, SIMTIME_MS)) == 0);
+            REQUIRE(farField.getInterference(Coord(3105, 5, 0), frequency, SimTime(10, SIMTIME_MS), SimTime(12, SIMTIME_MS)) == 0);
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), 5.9e9, SimTime(10, SIMTIME_MS), SimTime(12, SIMTIME_MS)) == 0);
+        }
+        THEN("it is forgotten once it is older than the history")
+        {
+            farField.addTransmission(Coord(5, 1005, 0), 20, frequency, SimTime(500, SIMTIME_MS), SimTime(2, SIMTIME_MS));
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(10, SIMTIME_MS), SimTime(12, SIMTIME_MS)) == 0);
+        }
+    }
+
+    GIVEN("two transmissions in the same cell")
+    {
+        farField.addTransmission(Coord(1001, 1, 0), 10, frequency, SimTime(10, SIMTIME_MS), SimTime(1, SIMTIME_MS));
+        farField.addTransmission(Coord(1009, 9, 0), 30, frequency, SimTime(10, SIMTIME_MS), SimTime(1, SIMTIME_MS));
+
+        THEN("their powers add up")
+        {
+            double expected = powerAt1m(40) / (1000 * 1000);
+            REQUIRE(farField.getInterference(Coord(5, 5, 0), frequency, SimTime(10, SIMTIME_MS), SimTime(11, SIMTIME_MS)) == Approx(expected));
+        }
+    }
+}
+
+SCENARIO("FarFieldInterference only visits cells around the receiver", "[farfield]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    // near field 200 m, far field up to 2000 m, 10 m cells, 1 ms bins, free space
+    FarFieldInterference farField(200, 2000, 10, SimTime(1, SIMTIME_MS), SimTime(100, SIMTIME_MS), 2.0);
+
+    GIVEN("transmissions from cell centers every 100 m along a line of 40 km, on both sides of the origin")
+    {
+        for (int i = -200; i < 200; i++) {
+            farField.addTransmission(Coord(i * 100 + 5, -995, 0), 20, frequency, SimTime(10, SIMTIME_MS), SimTime(1, SIMTIME_MS));
+        }
+
+        THEN("a receiver sees exactly the transmitters at far-field distance")
+        {
+            for (double x : {-15005.0, -5.0, 5.0, 12345.0}) {
+                Coord receiver(x, -5, 0);
+                double expected = 0;
+                for (int i = -200; i < 200; i++) {
+                    double dx = i * 100 + 5 - receiver.x;
+                    double dy = -995 - receiver.y;
+                    double distSquared = dx * dx + dy * dy;
+                    if (distSquared <= 200 * 200 || distSquared > 2000 * 2000) continue;
+                    expected += powerAt1m(20) / distSquared;
+                }
+                INFO("x = " << x);
+                REQUIRE(farField.getInterference(receiver, frequency, SimTime(10, SIMTIME_MS), SimTime(11, SIMTIME_MS)) == Approx(expected));
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <string>
+
+#include "veins/modules/utility/LruCache.h"
+
+using namespace veins;
+
+SCENARIO("LruCache", "[lrucache]")
+{
+    GIVEN("a cache with capacity 2")
+    {
+        LruCache<int, std::string> cache(2);
+        cache.insert(1, "one");
+        cache.insert(2, "two");
+        THEN("both entries can be found")
+        {
+            REQUIRE(cache.find(1) != nullptr);
+            REQUIRE(*cache.find(1) == "one");
+            REQUIRE(*cache.find(2) == "two");
+            REQUIRE(cache.size() == 2);
+        }
+        WHEN("a third entry is inserted")
+        {
+            cache.insert(3, "three");
+            THEN("the least recently inserted one is evicted")
+            {
+                REQUIRE(cache.find(1) == nullptr);
+                REQUIRE(*cache.find(2) == "two");
+                REQUIRE(*cache.find(3) == "three");
+                REQUIRE(cache.size() == 2);
+            }
+        }
+        WHEN("the oldest entry is looked up before inserting a third")
+        {
+            cache.find(1);
+            cache.insert(3, "three");
+            THEN("the least recently used one is evicted instead")
+            {
+                REQUIRE(*cache.find(1) == "one");
+                REQUIRE(cache.find(2) == nullptr);
+            }
+        }
+        WHEN("an existing key is inserted again")
+        {
+            cache.insert(1, "uno");
+            cache.insert(3, "three");
+            THEN("its value is replaced and it counts as recently used")
+            {
+                REQUIRE(*cache.find(1) == "uno");
+                REQUIRE(cache.find(2) == nullptr);
+            }
+        }
+        WHEN("entries are looked up")
+        {
+            cache.find(1);
+            cache.find(4);
+            cache.find(2);
+            THEN("hits and misses are counted")
+            {
+                REQUIRE(cache.getHits() == 2);
+                REQUIRE(cache.getMisses() == 1);
+            }
+        }
+        WHEN("entries are erased by a predicate")
+        {
+            size_t removed = cache.eraseIf([](int key, const std::string&) { return key == 2; });
+            THEN("only matching entries are removed")
+            {
+                REQUIRE(removed == 1);
+                REQUIRE(cache.size() == 1);
+                REQUIRE(cache.find(1) != nullptr);
+                REQUIRE(cache.find(2) == nullptr);
+            }
+        }
+        WHEN("the capacity is reduced")
+        {
+            cache.find(1);
+            cache.setCapacity(1);
+            THEN("only the most recently used entry is kept")
+            {
+                REQUIRE(cache.size() == 1);
+                REQUIRE(cache.find(1) != nullptr);
+            }
+        }
+    }
+    GIVEN("a cache with capacity 0")
+    {
+        LruCache<int, int> cache;
+        cache.insert(1, 1);
+        THEN("nothing is cached")
+        {
+            REQUIRE(cache.size() == 0);
+            REQUIRE(cache.find(1) == nullptr);
+        }
+    }
+}
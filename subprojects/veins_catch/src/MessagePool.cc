@@ -0,0 +1,138 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include "veins/modules/application/ieee80211p/MessagePool.h"
+#include "veins/modules/messages/DemoSafetyMessage_m.h"
+#include "veins/modules/messages/DemoServiceAdvertisement_m.h"
+#include "testutils/Simulation.h"
+
+using namespace veins;
+
+namespace {
+
+/**
+ * MessagePool with a given capacity (instead of the NED parameter) and access to its counters.
+ */
+class TestMessagePool : public MessagePool {
+public:
+    explicit TestMessagePool(size_t capacity)
+    {
+        this->capacity = capacity;
+    }
+
+    template <typename T>
+    const Pool& poolOf()
+    {
+        return getPool(typeid(T), &reconstruct<T>);
+    }
+};
+
+} // namespace
+
+SCENARIO("MessagePool", "[messagepool]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    TestMessagePool pool(1);
+
+    GIVEN("a message acquired from an empty pool")
+    {
+        DemoSafetyMessage* msg = pool.acquire<DemoSafetyMessage>();
+        THEN("it is a miss")
+        {
+            REQUIRE(pool.poolOf<DemoSafetyMessage>().hits == 0);
+            REQUIRE(pool.poolOf<DemoSafetyMessage>().misses == 1);
+            delete msg;
+        }
+        WHEN("it is modified, released and acquired again")
+        {
+            msg->setName("bsm");
+            msg->setKind(3);
+            msg->setUserPriority(2);
+            msg->setRecipientAddress(42);
+            msg->setSenderPos(Coord(1, 2, 3));
+            msg->setBitLength(800);
+            msg->setControlInfo(new cObject());
+            const auto id = msg->getId();
+            const auto treeId = msg->getTreeId();
+
+            pool.release(msg);
+            THEN("the pool owns it")
+            {
+                REQUIRE(msg->getOwner() == &pool);
+                REQUIRE(pool.poolOf<DemoSafetyMessage>().messages.size() == 1);
+            }
+
+            DemoSafetyMessage* recycled = pool.acquire<DemoSafetyMessage>();
+            THEN("the same memory is returned as a hit, still owned by the pool")
+            {
+                REQUIRE(recycled == msg);
+                REQUIRE(recycled->getOwner() == &pool);
+                REQUIRE(pool.poolOf<DemoSafetyMessage>().hits == 1);
+                REQUIRE(pool.poolOf<DemoSafetyMessage>().misses == 1);
+                REQUIRE(pool.poolOf<DemoSafetyMessage>().messages.empty());
+            }
+            THEN("it is in the state of a newly constructed message, with fresh ids")
+            {
+                DemoSafetyMessage fresh;
+                REQUIRE(std::string(recycled->getName()) == fresh.getName());
+                REQUIRE(recycled->getKind() == fresh.getKind());
+                REQUIRE(recycled->getUserPriority() == fresh.getUserPriority());
+                REQUIRE(recycled->getRecipientAddress() == fresh.getRecipientAddress());
+                REQUIRE(recycled->getSenderPos() == fresh.getSenderPos());
+                REQUIRE(recycled->getBitLength() == fresh.getBitLength());
+                REQUIRE(recycled->getControlInfo() == nullptr);
+                REQUIRE(recycled->getId() != id);
+                REQUIRE(recycled->getTreeId() != treeId);
+            }
+            delete recycled;
+        }
+    }
+
+    GIVEN("a full pool")
+    {
+        pool.release(pool.acquire<DemoSafetyMessage>());
+        WHEN("another message of its type is released")
+        {
+            pool.release(new DemoSafetyMessage());
+            THEN("it is discarded")
+            {
+                REQUIRE(pool.poolOf<DemoSafetyMessage>().messages.size() == 1);
+                REQUIRE(pool.poolOf<DemoSafetyMessage>().discarded == 1);
+            }
+        }
+    }
+
+    GIVEN("a message of a type nobody acquired from the pool")
+    {
+        WHEN("it is released")
+        {
+            pool.release(new DemoServiceAdvertisment());
+            THEN("it is deleted rather than pooled")
+            {
+                REQUIRE(pool.poolOf<DemoServiceAdvertisment>().messages.empty());
+                REQUIRE(pool.poolOf<DemoServiceAdvertisment>().discarded == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,146 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "veins/modules/obstacle/Obstacle.h"
+#include "testutils/ErlangenBuildings.h"
+
+using veins::Coord;
+using veins::Obstacle;
+using veins::loadErlangenBuildings;
+
+namespace {
+
+// reference implementation: edge by edge, as Obstacle did before storing edges as arrays
+
+bool referenceContainsPoint(const Obstacle::Coords& shape, Coord point)
+{
+    bool isInside = false;
+    Obstacle::Coords::const_iterator i = shape.begin();
+    Obstacle::Coords::const_iterator j = (shape.rbegin() + 1).base();
+    for (; i != shape.end(); j = i++) {
+        bool inYRangeUp = (point.y >= i->y) && (point.y < j->y);
+        bool inYRangeDown = (point.y >= j->y) && (point.y < i->y);
+        bool inYRange = inYRangeUp || inYRangeDown;
+        if (!inYRange) continue;
+        bool intersects = point.x < (i->x + ((point.y - i->y) * (j->x - i->x) / (j->y - i->y)));
+        if (!intersects) continue;
+        isInside = !isInside;
+    }
+    return isInside;
+}
+
+double referenceSegmentsIntersectAt(const Coord& p1From, const Coord& p1To, const Coord& p2From, const Coord& p2To)
+{
+    double p1x = p1To.x - p1From.x;
+    double p1y = p1To.y - p1From.y;
+    double p2x = p2To.x - p2From.x;
+    double p2y = p2To.y - p2From.y;
+    double p1p2x = p1From.x - p2From.x;
+    double p1p2y = p1From.y - p2From.y;
+    double D = (p1x * p2y - p1y * p2x);
+
+    double p1Frac = (p2x * p1p2y - p2y * p1p2x) / D;
+    if (p1Frac < 0 || p1Frac > 1) return -1;
+
+    double p2Frac = (p1x * p1p2y - p1y * p1p2x) / D;
+    if (p2Frac < 0 || p2Frac > 1) return -1;
+
+    return p1Frac;
+}
+
+std::vector<double> referenceIntersections(const Obstacle::Coords& shape, const Coord& senderPos, const Coord& receiverPos)
+{
+    std::vector<double> intersectAt;
+    Obstacle::Coords::const_iterator i = shape.begin();
+    Obstacle::Coords::const_iterator j = (shape.rbegin() + 1).base();
+    for (; i != shape.end(); j = i++) {
+        double f = referenceSegmentsIntersectAt(senderPos, receiverPos, *i, *j);
+        if (f != -1) {
+            intersectAt.push_back(f);
+        }
+    }
+    std::sort(intersectAt.begin(), intersectAt.end());
+    return intersectAt;
+}
+
+/**
+ * Compare lists of intersections, treating NaN (from degenerate edges, e.g. repeated corners) as equal.
+ */
+bool sameIntersections(const std::vector<double>& a, const std::vector<double>& b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](double x, double y) { return x == y || (std::isnan(x) && std::isnan(y)); });
+}
+
+} // namespace
+
+SCENARIO("Obstacle edge intersection", "[obstacle]")
+{
+    GIVEN("the buildings of the Erlangen scenario")
+    {
+        auto obstacles = loadErlangenBuildings();
+        REQUIRE(obstacles.size() > 100);
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<double> offset(-30, 30);
+
+        THEN("intersections and containment match the edge-by-edge implementation")
+        {
+            std::vector<double> intersectAt;
+            size_t numHits = 0;
+            size_t numInside = 0;
+            for (const auto& obstacle : obstacles) {
+                const Coord p1 = obstacle.getBboxP1();
+                const Coord p2 = obstacle.getBboxP2();
+                const Coord center((p1.x + p2.x) / 2, (p1.y + p2.y) / 2);
+                for (int i = 0; i < 20; ++i) {
+                    // beams from near the building to near the building, often crossing or starting inside it
+                    Coord sender(center.x + offset(rng), center.y + offset(rng));
+                    Coord receiver(center.x + offset(rng), center.y + offset(rng));
+                    // also test beams starting exactly at a corner
+                    if (i == 0) sender = obstacle.getShape().front();
+
+                    bool senderInside;
+                    bool receiverInside;
+                    obstacle.intersect(sender, receiver, intersectAt, senderInside, receiverInside);
+
+                    REQUIRE(sameIntersections(intersectAt, referenceIntersections(obstacle.getShape(), sender, receiver)));
+                    REQUIRE(sameIntersections(obstacle.getIntersections(sender, receiver), intersectAt));
+                    REQUIRE(senderInside == referenceContainsPoint(obstacle.getShape(), sender));
+                    REQUIRE(receiverInside == referenceContainsPoint(obstacle.getShape(), receiver));
+                    REQUIRE(obstacle.containsPoint(sender) == senderInside);
+                    numHits += intersectAt.size();
+                    numInside += senderInside + receiverInside;
+                }
+            }
+            // make sure the test actually covered interesting cases
+            REQUIRE(numHits > 0);
+            REQUIRE(numInside > 0);
+        }
+    }
+}
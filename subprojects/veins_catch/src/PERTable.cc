@@ -0,0 +1,93 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include <sstream>
+
+#include "veins/modules/phy/PERTable.h"
+
+using namespace veins;
+
+namespace {
+
+const char* table =
+    "# datarate snr per\n"
+    "6000000 0 1\n"
+    "\n"
+    "6000000 10 0\n"
+    "6000000 5 0.2\n"
+    "12000000 8 0.5\n";
+
+PERTable parse(const std::string& text)
+{
+    std::istringstream in(text);
+    return PERTable(in);
+}
+
+} // namespace
+
+SCENARIO("PERTable lookup", "[per]")
+{
+    GIVEN("a table with two data rates")
+    {
+        PERTable t = parse(table);
+        THEN("it knows exactly the data rates listed")
+        {
+            REQUIRE(t.hasDatarate(6000000));
+            REQUIRE(t.hasDatarate(12000000));
+            REQUIRE_FALSE(t.hasDatarate(3000000));
+        }
+        THEN("listed points are returned exactly, regardless of their order in the file")
+        {
+            REQUIRE(t.getPER(6000000, 0) == Approx(1));
+            REQUIRE(t.getPER(6000000, 5) == Approx(0.2));
+            REQUIRE(t.getPER(6000000, 10) == Approx(0));
+        }
+        THEN("values between points are interpolated linearly")
+        {
+            REQUIRE(t.getPER(6000000, 2.5) == Approx(0.6));
+            REQUIRE(t.getPER(6000000, 7.5) == Approx(0.1));
+        }
+        THEN("values outside the table are clamped")
+        {
+            REQUIRE(t.getPER(6000000, -20) == Approx(1));
+            REQUIRE(t.getPER(6000000, 40) == Approx(0));
+            REQUIRE(t.getPER(12000000, 0) == Approx(0.5));
+            REQUIRE(t.getPER(12000000, 20) == Approx(0.5));
+        }
+        THEN("unknown data rates are rejected")
+        {
+            REQUIRE_THROWS(t.getPER(3000000, 5));
+        }
+    }
+}
+
+SCENARIO("PERTable parsing errors", "[per]")
+{
+    REQUIRE_THROWS(parse(""));
+    REQUIRE_THROWS(parse("# only a comment\n"));
+    REQUIRE_THROWS(parse("6000000 5\n"));
+    REQUIRE_THROWS(parse("6000000 5 0.1 extra\n"));
+    REQUIRE_THROWS(parse("6000000 5 1.5\n"));
+    REQUIRE_THROWS(parse("6000000 5 0.1\n6000000 5 0.2\n"));
+}
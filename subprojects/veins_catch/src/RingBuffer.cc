@@ -0,0 +1,110 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include "veins/modules/utility/RingBuffer.h"
+
+using namespace veins;
+
+SCENARIO("RingBuffer", "[ringbuffer]")
+{
+    GIVEN("an empty ring buffer")
+    {
+        RingBuffer<int> buffer;
+        THEN("it holds nothing")
+        {
+            REQUIRE(buffer.empty());
+            REQUIRE(buffer.size() == 0);
+        }
+        WHEN("elements are pushed and popped")
+        {
+            buffer.push(1);
+            buffer.push(2);
+            buffer.push(3);
+            buffer.pop();
+            buffer.push(4);
+            THEN("they come out in FIFO order")
+            {
+                REQUIRE(buffer.size() == 3);
+                REQUIRE(buffer.front() == 2);
+                REQUIRE(buffer.back() == 4);
+                buffer.pop();
+                REQUIRE(buffer.front() == 3);
+                buffer.pop();
+                REQUIRE(buffer.front() == 4);
+                buffer.pop();
+                REQUIRE(buffer.empty());
+            }
+        }
+        WHEN("it grows while the elements wrap around the end of the buffer")
+        {
+            for (int i = 0; i < 3; ++i) buffer.push(i);
+            buffer.pop();
+            buffer.pop();
+            for (int i = 3; i < 20; ++i) buffer.push(i);
+            THEN("the order is preserved")
+            {
+                REQUIRE(buffer.size() == 18);
+                for (int i = 2; i < 20; ++i) {
+                    REQUIRE(buffer.front() == i);
+                    buffer.pop();
+                }
+                REQUIRE(buffer.empty());
+            }
+        }
+        WHEN("the front element is replaced")
+        {
+            buffer.push(1);
+            buffer.push(2);
+            buffer.front() = 5;
+            THEN("the size does not change")
+            {
+                REQUIRE(buffer.size() == 2);
+                REQUIRE(buffer.front() == 5);
+            }
+        }
+    }
+    GIVEN("a ring buffer with reserved capacity")
+    {
+        RingBuffer<int> buffer;
+        buffer.reserve(5);
+        THEN("the capacity is rounded up to a power of two")
+        {
+            REQUIRE(buffer.capacity() == 8);
+        }
+        WHEN("it is filled up to its capacity")
+        {
+            buffer.push(-1);
+            buffer.pop();
+            for (int i = 0; i < 8; ++i) buffer.push(i);
+            THEN("it does not grow")
+            {
+                REQUIRE(buffer.size() == 8);
+                REQUIRE(buffer.capacity() == 8);
+                REQUIRE(buffer.front() == 0);
+                REQUIRE(buffer.back() == 7);
+            }
+        }
+    }
+}
@@ -66,3 +66,55 @@ SCENARIO("Using SampledAntenna1D", "[toolbox]")
         }
     }
 }
+
+SCENARIO("Computing pseudo-angles for SampledAntenna1D", "[toolbox]")
+{
+    GIVEN("Vectors at multiples of 45 degrees")
+    {
+        for (int i = 0; i < 8; i++) {
+            double angle = i * M_PI / 4;
+            INFO("vector at " << i * 45 << " degrees should have a pseudo-angle of " << i * 0.5);
+            REQUIRE(SampledAntenna1D::getPseudoAngle(2 * cos(angle), 2 * sin(angle)) == Approx(i * 0.5).margin(1e-12));
+        }
+    }
+
+    GIVEN("Vectors at increasing angles")
+    {
+        double last = -1;
+        for (int i = 0; i < 3600; i++) {
+            double angle = i * M_PI / 1800;
+            double pseudoAngle = SampledAntenna1D::getPseudoAngle(cos(angle), sin(angle));
+            INFO("pseudo-angle at " << i * 0.1 << " degrees should be larger than " << last);
+            REQUIRE(pseudoAngle > last);
+            REQUIRE(pseudoAngle < 4);
+            last = pseudoAngle;
+        }
+    }
+}
+
+SCENARIO("Using SampledAntenna1D with samples not aligned to its gain table", "[toolbox]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+
+    GIVEN("A SampledAntenna1D with 3 samples")
+    {
+        std::vector<double> values = {0, -10, 6};
+        std::vector<double> noParams;
+        auto p = SampledAntenna1D(values, "", noParams, "", noParams, nullptr);
+
+        // reference: linear interpolation of the samples in dBi
+        auto reference = [&values](double angle) {
+            double distance = 2 * M_PI / values.size();
+            size_t base = static_cast<size_t>(angle / distance);
+            double offset = (angle - base * distance) / distance;
+            return values[base] + offset * (values[(base + 1) % values.size()] - values[base]);
+        };
+
+        for (int i = 0; i < 360; i += 7) {
+            double angle = i * M_PI / 180;
+            double gain = p.getGain(Coord(0, 0, 0), Coord(1, 0, 0), Coord(cos(angle), sin(angle), 0));
+            INFO("gain at " << i << " degrees should be within 0.01 dB of interpolated samples");
+            REQUIRE(FWMath::mW2dBm(gain) == Approx(reference(angle)).margin(0.01));
+        }
+    }
+}
@@ -0,0 +1,126 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+
+#include "catch2/catch.hpp"
+
+#include <cmath>
+#include <sstream>
+
+#include "veins/base/utils/ThreadPool.h"
+#include "veins/modules/obstacle/ShadowingMap.h"
+#include "veins/modules/utility/BinaryStream.h"
+
+using namespace veins;
+
+namespace {
+
+/**
+ * Attenuation of 1 dB per 10 m of distance, which is easy to predict for any pair of cells.
+ */
+double attenuationByDistance(const Coord& senderPos, const Coord& receiverPos)
+{
+    return senderPos.distance(receiverPos) / 10;
+}
+
+} // namespace
+
+SCENARIO("ShadowingMap looks up attenuation between cell centers", "[shadowingMap]")
+{
+    GIVEN("a map of 10 m cells, covering pairs of cells up to 50 m apart")
+    {
+        ShadowingMap map(200, 100, 10, 50, attenuationByDistance);
+
+        THEN("positions anywhere in two cells get the attenuation between the cells' centers")
+        {
+            double attenuation = -1;
+            REQUIRE(map.lookup({11, 12}, {48, 19}, 0, attenuation));
+            REQUIRE(attenuation == Approx(3).margin(0.25));
+            REQUIRE(map.lookup({48, 19}, {11, 12}, 0, attenuation));
+            REQUIRE(attenuation == Approx(3).margin(0.25));
+            REQUIRE(map.lookup({5, 5}, {5, 5}, 0, attenuation));
+            REQUIRE(attenuation == 0);
+        }
+        THEN("pairs of cells too far apart or outside the playground are not covered")
+        {
+            double attenuation = -1;
+            REQUIRE_FALSE(map.lookup({5, 5}, {65, 5}, 0, attenuation));
+            REQUIRE_FALSE(map.lookup({5, 5}, {45, 45}, 0, attenuation));
+            REQUIRE_FALSE(map.lookup({-5, 5}, {5, 5}, 0, attenuation));
+            REQUIRE_FALSE(map.lookup({195, 5}, {215, 5}, 0, attenuation));
+            REQUIRE(attenuation == -1);
+        }
+        THEN("positions close to a cell border are refused if asked to")
+        {
+            double attenuation = -1;
+            REQUIRE(map.lookup({15, 15}, {35, 15}, 2, attenuation));
+            REQUIRE_FALSE(map.lookup({11, 15}, {35, 15}, 2, attenuation));
+            REQUIRE_FALSE(map.lookup({15, 15}, {35, 19}, 2, attenuation));
+        }
+        THEN("it can be written and read back")
+        {
+            std::ostringstream stream;
+            BinaryWriter out(stream);
+            map.write(out);
+            const std::string data = stream.str();
+            BinaryReader in(data.data(), data.data() + data.size());
+            ShadowingMap readMap = ShadowingMap::read(in);
+            REQUIRE(in.atEnd());
+            REQUIRE(readMap.getCellSize() == 10);
+            REQUIRE(readMap.getRange() == 50);
+            for (double x = 1; x < 200; x += 7) {
+                double expected = -1;
+                double actual = -1;
+                REQUIRE(map.lookup({23, 47}, {x, 61}, 0, expected) == readMap.lookup({23, 47}, {x, 61}, 0, actual));
+                REQUIRE(actual == expected);
+            }
+        }
+    }
+    GIVEN("a map computed by several threads")
+    {
+        ThreadPool pool(4);
+        ShadowingMap parallel(300, 300, 10, 80, attenuationByDistance, &pool);
+        ShadowingMap sequential(300, 300, 10, 80, attenuationByDistance);
+        THEN("it holds the same values as one computed sequentially")
+        {
+            for (double x = 3; x < 300; x += 11) {
+                for (double y = 3; y < 300; y += 13) {
+                    double expected = -1;
+                    double actual = -1;
+                    REQUIRE(sequential.lookup({150, 150}, {x, y}, 0, expected) == parallel.lookup({150, 150}, {x, y}, 0, actual));
+                    REQUIRE(actual == expected);
+                }
+            }
+        }
+    }
+    GIVEN("an attenuation too high to be stored")
+    {
+        ShadowingMap map(100, 100, 10, 50, [](const Coord&, const Coord&) { return HUGE_VAL; });
+        THEN("it saturates")
+        {
+            double attenuation = -1;
+            REQUIRE(map.lookup({5, 5}, {25, 5}, 0, attenuation));
+            REQUIRE(attenuation == 127);
+        }
+    }
+}
@@ -748,6 +748,17 @@ SCENARIO("Signal Thresholding (smaller)", "[toolbox]")
                 REQUIRE(signal.getNumAnalogueModelsApplied() == 2);
             }
         }
+        WHEN("the first AM is marked as already applied and a given power that requires both AMs is checked")
+        {
+            signal.setAnalogueModelList(&analogueModels, 1);
+            bool belowThreshold = signal.smallerAtCenterFrequency(2.5);
+            THEN("only the second AM is applied")
+            {
+                REQUIRE(belowThreshold == false);
+                REQUIRE(signal.getAtCenterFrequency() == 15);
+                REQUIRE(signal.getNumAnalogueModelsApplied() == 2);
+            }
+        }
     }
 }
 
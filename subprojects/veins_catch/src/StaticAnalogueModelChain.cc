@@ -0,0 +1,118 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include "veins/modules/analogueModel/StaticAnalogueModelChain.h"
+#include "veins/base/toolbox/Spectrum.h"
+#include "veins/base/toolbox/Signal.h"
+#include "testutils/Simulation.h"
+#include "testutils/Component.h"
+
+using namespace veins;
+
+namespace {
+
+using PathlossNakagamiChain = StaticAnalogueModelChain<SimplePathlossModel, NakagamiFading>;
+
+Signal createSignal(const Spectrum& spec, double receiverX, uint64_t randomStreamKey)
+{
+    Signal s(spec);
+    for (size_t i = 0; i < s.getNumValues(); i++) {
+        s.at(i) = 10 + i;
+    }
+    s.setSenderPoa({AntennaPosition(1, Coord(0, 0, 2), Coord(0, 0, 0), simTime()), {}, nullptr});
+    s.setReceiverPoa({AntennaPosition(2, Coord(receiverX, 0, 2), Coord(0, 0, 0), simTime()), {}, nullptr});
+    s.setRandomStreamKey(randomStreamKey);
+    return s;
+}
+
+} // namespace
+
+SCENARIO("StaticAnalogueModelChain", "[analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+    Spectrum::Frequencies freqs = {5.885e9, 5.89e9, 5.895e9};
+    Spectrum spec(freqs);
+
+    SimplePathlossModel pathloss(&dc, 2.2, false, {0, 0, 0});
+    NakagamiFading fading(&dc, false, 0);
+    PathlossNakagamiChain chain(&dc, make_unique<SimplePathlossModel>(&dc, 2.2, false, Coord(0, 0, 0)), make_unique<NakagamiFading>(&dc, false, 0));
+
+    GIVEN("Signals to receivers near and far, with identical random streams")
+    {
+        THEN("the chain yields exactly the same values as applying the models one after another")
+        {
+            for (double receiverX : {0.5, 10.0, 79.0, 81.0, 500.0}) {
+                for (uint64_t key = 1; key <= 20; key++) {
+                    Signal expected = createSignal(spec, receiverX, key);
+                    pathloss.filterSignal(&expected);
+                    fading.filterSignal(&expected);
+
+                    Signal actual = createSignal(spec, receiverX, key);
+                    chain.filterSignal(&actual);
+
+                    for (size_t i = 0; i < expected.getNumValues(); i++) {
+                        REQUIRE(actual.at(i) == expected.at(i));
+                    }
+                }
+            }
+        }
+
+        THEN("the chain has the properties all of its models have")
+        {
+            REQUIRE(chain.isStateless());
+            REQUIRE(chain.isThreadSafe());
+            REQUIRE_FALSE(chain.isDeterministic());
+            REQUIRE_FALSE(chain.neverIncreasesPower());
+        }
+    }
+}
+
+TEST_CASE("Analogue models applied one after another and as a StaticAnalogueModelChain", "[.][benchmark][analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+    Spectrum::Frequencies freqs = {5.885e9, 5.89e9, 5.895e9};
+    Spectrum spec(freqs);
+
+    AnalogueModelList models = {std::make_shared<SimplePathlossModel>(&dc, 2.2, false, Coord(0, 0, 0)), std::make_shared<NakagamiFading>(&dc, false, 0)};
+    PathlossNakagamiChain chain(&dc, make_unique<SimplePathlossModel>(&dc, 2.2, false, Coord(0, 0, 0)), make_unique<NakagamiFading>(&dc, false, 0));
+    Signal s = createSignal(spec, 123.4, 1);
+
+    BENCHMARK("one after another")
+    {
+        s = 1;
+        for (auto& model : models) {
+            model->filterSignal(&s);
+        }
+        return s.at(0);
+    };
+
+    BENCHMARK("static chain")
+    {
+        s = 1;
+        chain.filterSignal(&s);
+        return s.at(0);
+    };
+}
@@ -0,0 +1,125 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "veins/base/utils/CounterRng.h"
+#include "veins/base/utils/ThreadPool.h"
+
+using namespace veins;
+
+namespace {
+
+std::vector<double> drawGammas(ThreadPool& pool, size_t n)
+{
+    std::vector<double> results(n);
+    pool.parallelFor(n, [&results](size_t i) {
+        CounterRng rng(CounterRng::combine(42, i));
+        results[i] = rng.gamma(0.75, 2);
+    });
+    return results;
+}
+
+} // namespace
+
+SCENARIO("ThreadPool processes every item exactly once", "[threadPool]")
+{
+    for (size_t numThreads : {1, 2, 4}) {
+        GIVEN("a pool of " << numThreads << " threads")
+        {
+            ThreadPool pool(numThreads);
+            REQUIRE(pool.getNumThreads() == numThreads);
+
+            THEN("all items are processed, on worker threads only")
+            {
+                std::vector<int> counts(1000, 0);
+                std::vector<char> inSection(counts.size(), 0);
+                pool.parallelFor(counts.size(), [&](size_t i) {
+                    counts[i]++;
+                    inSection[i] = ThreadPool::isInParallelSection();
+                });
+                for (size_t i = 0; i < counts.size(); i++) {
+                    REQUIRE(counts[i] == 1);
+                    REQUIRE(inSection[i]);
+                }
+                REQUIRE_FALSE(ThreadPool::isInParallelSection());
+            }
+            THEN("the pool can be reused, also for fewer items than threads")
+            {
+                for (size_t n : {0, 1, 3, 100}) {
+                    std::vector<int> counts(n, 0);
+                    pool.parallelFor(n, [&counts](size_t i) { counts[i]++; });
+                    for (auto count : counts) REQUIRE(count == 1);
+                }
+            }
+            THEN("exceptions are passed to the caller")
+            {
+                REQUIRE_THROWS_AS(pool.parallelFor(100, [](size_t i) {
+                    if (i == 17) throw std::runtime_error("failed");
+                }),
+                    std::runtime_error);
+            }
+        }
+    }
+}
+
+SCENARIO("CounterRng streams", "[threadPool]")
+{
+    GIVEN("streams with equal and different keys")
+    {
+        CounterRng a(CounterRng::combine(1, 2));
+        CounterRng b(CounterRng::combine(1, 2));
+        CounterRng c(CounterRng::combine(2, 1));
+        THEN("equal keys give equal numbers, different keys different ones")
+        {
+            for (int i = 0; i < 10; i++) {
+                uint64_t x = a.next();
+                REQUIRE(x == b.next());
+                REQUIRE(x != c.next());
+            }
+        }
+    }
+    GIVEN("many gamma distributed numbers")
+    {
+        CounterRng rng(7);
+        const int n = 100000;
+        double sum = 0;
+        for (int i = 0; i < n; i++) sum += rng.gamma(1.5, 2);
+        THEN("their mean is shape times scale")
+        {
+            REQUIRE(sum / n == Approx(3).epsilon(0.02));
+        }
+    }
+    GIVEN("numbers drawn from per-item streams on pools of different sizes")
+    {
+        ThreadPool one(1);
+        ThreadPool four(4);
+        THEN("results do not depend on the number of threads")
+        {
+            REQUIRE(drawGammas(one, 500) == drawGammas(four, 500));
+        }
+    }
+}
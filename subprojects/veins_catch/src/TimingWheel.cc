@@ -0,0 +1,114 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <map>
+#include <random>
+
+#include "veins/modules/utility/TimingWheel.h"
+
+using namespace veins;
+
+SCENARIO("TimingWheel", "[timingwheel]")
+{
+    GIVEN("a wheel of 4 slots of length 10")
+    {
+        TimingWheel<int> wheel(10, 4);
+        THEN("it is empty")
+        {
+            REQUIRE(wheel.empty());
+        }
+        WHEN("values are inserted out of order, some of them more than a revolution ahead")
+        {
+            wheel.insert(95, 1);
+            wheel.insert(12, 2);
+            wheel.insert(5, 3);
+            wheel.insert(52, 4);
+            THEN("they are popped in order of their time")
+            {
+                REQUIRE(wheel.size() == 4);
+                REQUIRE(wheel.nextTime() == 5);
+                REQUIRE(wheel.pop().second == 3);
+                REQUIRE(wheel.pop().second == 2);
+                REQUIRE(wheel.pop() == std::make_pair(int64_t(52), 4));
+                REQUIRE(wheel.pop() == std::make_pair(int64_t(95), 1));
+                REQUIRE(wheel.empty());
+            }
+        }
+        WHEN("values due at the same time are inserted")
+        {
+            wheel.insert(20, 1);
+            wheel.insert(20, 2);
+            wheel.insert(20, 3);
+            THEN("they are popped in insertion order")
+            {
+                REQUIRE(wheel.pop().second == 1);
+                REQUIRE(wheel.pop().second == 2);
+                REQUIRE(wheel.pop().second == 3);
+            }
+        }
+        WHEN("a value is inserted before the earliest one after it was looked up")
+        {
+            wheel.insert(30, 1);
+            REQUIRE(wheel.nextTime() == 30);
+            wheel.insert(31, 2);
+            wheel.insert(3, 3);
+            THEN("it is popped first")
+            {
+                REQUIRE(wheel.nextTime() == 3);
+                REQUIRE(wheel.pop().second == 3);
+                REQUIRE(wheel.pop().second == 1);
+                REQUIRE(wheel.pop().second == 2);
+            }
+        }
+    }
+    GIVEN("a wheel fed with random periodic events")
+    {
+        TimingWheel<int> wheel(7, 16);
+        std::multimap<std::pair<int64_t, int>, int> reference;
+        std::mt19937 rng(42);
+        int64_t now = 0;
+        int sequence = 0;
+        THEN("it behaves like a priority queue ordered by time and insertion")
+        {
+            for (int i = 0; i < 20000; ++i) {
+                if (reference.empty() || rng() % 2 == 0) {
+                    int64_t time = now + (rng() % 4 == 0 ? rng() % 1000 : rng() % 30);
+                    wheel.insert(time, sequence);
+                    reference.insert({{time, sequence}, sequence});
+                    ++sequence;
+                }
+                else {
+                    auto expected = reference.begin();
+                    auto popped = wheel.pop();
+                    REQUIRE(popped.first == expected->first.first);
+                    REQUIRE(popped.second == expected->second);
+                    now = popped.first;
+                    reference.erase(expected);
+                }
+                REQUIRE(wheel.size() == reference.size());
+            }
+        }
+    }
+}
@@ -24,6 +24,7 @@
 
 #include "veins/modules/analogueModel/TwoRayInterferenceModel.h"
 #include "veins/base/messages/AirFrame_m.h"
+#include "veins/base/utils/FWMath.h"
 #include "testutils/Simulation.h"
 #include "testutils/AirFrame.h"
 #include "testutils/Component.h"
@@ -68,3 +69,116 @@ SCENARIO("TwoRayInterferenceModel", "[analogueModel]")
         }
     }
 }
+
+namespace {
+
+double attenuationAt(TwoRayInterferenceModel& model, double d, double ht, double hr)
+{
+    AirFrame frame = createAirframe(5.9e9, 10e6, 0, .001, 1);
+    int dummyId = -1;
+    Signal& s = frame.getSignal();
+    s.setSenderPoa({{dummyId, Coord(0, 0, ht), Coord(0, 0, 0), simTime()}, {}, nullptr});
+    s.setReceiverPoa({{dummyId, Coord(d, 0, hr), Coord(0, 0, 0), simTime()}, {}, nullptr});
+    model.filterSignal(&s);
+    return s.atFrequency(5.9e9);
+}
+
+} // namespace
+
+SCENARIO("TwoRayInterferenceModel with attenuation table", "[analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+
+    GIVEN("An exact and a tabulated TwoRayInterferenceModel with a resolution of 0.1 m")
+    {
+        TwoRayInterferenceModel exact(&dc, 1.02);
+        TwoRayInterferenceModel tabulated(&dc, 1.02, 0.1, 1000);
+
+        THEN("attenuation deviates by less than 0.05 dB for distances covered by the table")
+        {
+            // halfway between two rows of the table, where interpolation is least accurate
+            for (double d = 10.05; d < 1000; d += 3.7) {
+                for (double hr : {1.895, 6.0}) {
+                    INFO("d = " << d << ", hr = " << hr);
+                    double reference = attenuationAt(exact, d, 1.895, hr);
+                    double value = attenuationAt(tabulated, d, 1.895, hr);
+                    REQUIRE(FWMath::mW2dBm(value) == Approx(FWMath::mW2dBm(reference)).margin(0.05));
+                }
+            }
+        }
+
+        THEN("attenuation deviates by less than 0.05 dB between two rows of the table")
+        {
+            for (double d = 10; d < 1000; d += 3.7) {
+                for (double offset : {0.01, 0.025, 0.05, 0.075, 0.09}) {
+                    INFO("d = " << d + offset);
+                    double reference = attenuationAt(exact, d + offset, 1.895, 6.0);
+                    double value = attenuationAt(tabulated, d + offset, 1.895, 6.0);
+                    REQUIRE(FWMath::mW2dBm(value) == Approx(FWMath::mW2dBm(reference)).margin(0.05));
+                }
+            }
+        }
+
+        THEN("attenuation is exact outside of the table")
+        {
+            REQUIRE(attenuationAt(tabulated, 5, 1.895, 1.895) == attenuationAt(exact, 5, 1.895, 1.895));
+            REQUIRE(attenuationAt(tabulated, 1500, 1.895, 1.895) == attenuationAt(exact, 1500, 1.895, 1.895));
+        }
+
+        THEN("antenna heights are rounded to the nearest millimeter")
+        {
+            REQUIRE(attenuationAt(tabulated, 123.45, 1.8951, 1.5004) == attenuationAt(tabulated, 123.45, 1.895, 1.5));
+            REQUIRE(attenuationAt(tabulated, 123.45, 1.8951, 1.5006) != attenuationAt(tabulated, 123.45, 1.895, 1.5));
+        }
+    }
+
+    GIVEN("A tabulated TwoRayInterferenceModel keeping a single table")
+    {
+        TwoRayInterferenceModel exact(&dc, 1.02);
+        TwoRayInterferenceModel tabulated(&dc, 1.02, 0.1, 1000, 0.001, 1);
+
+        THEN("alternating antenna heights evict and rebuild tables without affecting attenuation")
+        {
+            for (double d = 10.05; d < 1000; d += 37) {
+                for (double hr : {1.5, 1.895, 6.0}) {
+                    INFO("d = " << d << ", hr = " << hr);
+                    double reference = attenuationAt(exact, d, 1.895, hr);
+                    double value = attenuationAt(tabulated, d, 1.895, hr);
+                    REQUIRE(FWMath::mW2dBm(value) == Approx(FWMath::mW2dBm(reference)).margin(0.05));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TwoRayInterferenceModel with and without attenuation table", "[.][benchmark][analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+
+    TwoRayInterferenceModel exact(&dc, 1.02);
+    TwoRayInterferenceModel tabulated(&dc, 1.02, 0.1, 1000);
+    // build table before measuring
+    attenuationAt(tabulated, 100, 1.895, 1.895);
+
+    AirFrame frame = createAirframe(5.9e9, 10e6, 0, .001, 1);
+    int dummyId = -1;
+    Signal& s = frame.getSignal();
+    s.setSenderPoa({{dummyId, Coord(0, 0, 1.895), Coord(0, 0, 0), simTime()}, {}, nullptr});
+    s.setReceiverPoa({{dummyId, Coord(123.4, 0, 1.895), Coord(0, 0, 0), simTime()}, {}, nullptr});
+
+    BENCHMARK("exact")
+    {
+        s = 1;
+        exact.filterSignal(&s);
+        return s.at(0);
+    };
+
+    BENCHMARK("tabulated")
+    {
+        s = 1;
+        tabulated.filterSignal(&s);
+        return s.at(0);
+    };
+}
@@ -20,6 +20,10 @@
 // Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 //
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include "catch2/catch.hpp"
 
 #include "veins/modules/obstacle/VehicleObstacleControl.h"
@@ -28,6 +32,7 @@
 #include "testutils/Simulation.h"
 
 using veins::Coord;
+using veins::MobileHostObstacle;
 using veins::Signal;
 using veins::Spectrum;
 using veins::VehicleObstacleControl;
@@ -109,3 +114,175 @@ SCENARIO("Using VehicleObstacleControl", "[vehicleObstacles]")
         }
     }
 }
+
+SCENARIO("Intersecting a line of sight with a vehicle footprint", "[vehicleObstacles]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+
+    MobileHostObstacle::Coords shape = {{10, -1}, {14, -1}, {14, 1}, {10, 1}};
+
+    GIVEN("A line of sight crossing the footprint")
+    {
+        THEN("The footprint is hit where the line of sight enters it")
+        {
+            REQUIRE(MobileHostObstacle::getIntersectionPoint(shape, Coord(0, 0), Coord(20, 0)) == Approx(10));
+            REQUIRE(MobileHostObstacle::getIntersectionPoint(shape, Coord(20, 0), Coord(0, 0)) == Approx(6));
+        }
+    }
+
+    GIVEN("A line of sight passing by the footprint")
+    {
+        THEN("The footprint is not hit")
+        {
+            REQUIRE(std::isnan(MobileHostObstacle::getIntersectionPoint(shape, Coord(0, 2), Coord(20, 2))));
+        }
+    }
+
+    GIVEN("A sender inside the footprint")
+    {
+        THEN("The footprint is hit right at the sender")
+        {
+            REQUIRE(MobileHostObstacle::getIntersectionPoint(shape, Coord(12, 0), Coord(20, 0)) == 0);
+        }
+    }
+}
+
+namespace {
+
+std::vector<double> attenuationFactorsDZ(const std::vector<std::pair<double, double>>& dz_vec, const Spectrum& spectrum)
+{
+    auto attenuationDB = VehicleObstacleControl::getVehicleAttenuationDZ(dz_vec, Signal(spectrum));
+    std::vector<double> factors;
+    for (size_t i = 0; i < attenuationDB.getNumValues(); i++) {
+        factors.push_back(pow(10.0, -attenuationDB.at(i) / 10.0));
+    }
+    return factors;
+}
+
+std::vector<double> attenuationFactorsInPlace(const std::vector<std::pair<double, double>>& dz_vec, const Spectrum& spectrum)
+{
+    std::vector<double> factors(spectrum.getNumFreqs(), 1.0);
+    VehicleObstacleControl::attenuateByVehicles(dz_vec, VehicleObstacleControl::getInvSqrtWavelengths(spectrum), factors.data());
+    return factors;
+}
+
+// a convoy of vehicles of alternating height between a sender and a receiver
+std::vector<std::pair<double, double>> makeConvoy(size_t numVehicles)
+{
+    std::vector<std::pair<double, double>> dz_vec = {{0, 1.5}};
+    for (size_t i = 0; i < numVehicles; i++) {
+        dz_vec.emplace_back(8.0 * (i + 1), (i % 3 == 0) ? 3.2 : 1.4 + 0.05 * i);
+    }
+    dz_vec.emplace_back(8.0 * (numVehicles + 1), 1.8);
+    return dz_vec;
+}
+
+} // namespace
+
+SCENARIO("Attenuating a signal by vehicles in place", "[vehicleObstacles]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+
+    Spectrum::Frequencies freqs = {5.86e9, 5.87e9, 5.88e9, 5.89e9, 5.9e9};
+    Spectrum spectrum(freqs);
+
+    GIVEN("One to twelve vehicles on the line of sight")
+    {
+        THEN("The in-place kernel matches getVehicleAttenuationDZ")
+        {
+            for (size_t n = 1; n <= 12; n++) {
+                auto dz_vec = makeConvoy(n);
+                auto expected = attenuationFactorsDZ(dz_vec, spectrum);
+                auto actual = attenuationFactorsInPlace(dz_vec, spectrum);
+                REQUIRE(actual.size() == expected.size());
+                for (size_t i = 0; i < expected.size(); i++) {
+                    REQUIRE(actual[i] == Approx(expected[i]).epsilon(1e-9));
+                }
+            }
+        }
+    }
+
+    GIVEN("The textbook constellations of sender, obstacles, and receiver")
+    {
+        THEN("The in-place kernel matches getVehicleAttenuationDZ")
+        {
+            std::vector<std::vector<std::pair<double, double>>> constellations = {
+                {{0, 10}, {3, 9}, {7, 8}},
+                {{0, 5}, {5, 5}, {10, 5}},
+                {{0, 5}, {3, 5}, {7, 5}, {10, 5}},
+                {{0, 1.5}, {10, 1.4}, {20, 1.3}, {30, 1.6}, {40, 1.5}},
+            };
+            for (const auto& dz_vec : constellations) {
+                auto expected = attenuationFactorsDZ(dz_vec, spectrum);
+                auto actual = attenuationFactorsInPlace(dz_vec, spectrum);
+                for (size_t i = 0; i < expected.size(); i++) {
+                    REQUIRE(actual[i] == Approx(expected[i]).epsilon(1e-9));
+                }
+            }
+        }
+    }
+
+    GIVEN("Random constellations of sender, receiver, and up to twelve vehicles")
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> height(1.0, 4.0);
+        std::uniform_real_distribution<double> gap(2.0, 20.0);
+
+        THEN("The in-place kernel matches getVehicleAttenuationDZ")
+        {
+            for (size_t n = 0; n < 1000; n++) {
+                std::vector<std::pair<double, double>> dz_vec = {{0, height(rng)}};
+                for (size_t i = 0; i <= 1 + n % 12; i++) {
+                    dz_vec.emplace_back(dz_vec.back().first + gap(rng), height(rng));
+                }
+                auto expected = attenuationFactorsDZ(dz_vec, spectrum);
+                auto actual = attenuationFactorsInPlace(dz_vec, spectrum);
+                for (size_t i = 0; i < expected.size(); i++) {
+                    REQUIRE(actual[i] == Approx(expected[i]).epsilon(1e-9));
+                }
+            }
+        }
+    }
+
+    GIVEN("A spectrum with more frequencies than are processed at once")
+    {
+        Spectrum::Frequencies wideFreqs;
+        for (size_t i = 0; i < 150; i++) {
+            wideFreqs.push_back(5.85e9 + i * 0.1e6);
+        }
+        Spectrum wide(wideFreqs);
+        auto dz_vec = makeConvoy(5);
+
+        THEN("The in-place kernel matches getVehicleAttenuationDZ for every frequency")
+        {
+            auto expected = attenuationFactorsDZ(dz_vec, wide);
+            auto actual = attenuationFactorsInPlace(dz_vec, wide);
+            for (size_t i = 0; i < expected.size(); i++) {
+                REQUIRE(actual[i] == Approx(expected[i]).epsilon(1e-9));
+            }
+        }
+    }
+}
+
+TEST_CASE("Vehicle attenuation via Signals and in place", "[.][benchmark][vehicleObstacles]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+
+    Spectrum::Frequencies freqs = {5.86e9, 5.87e9, 5.88e9, 5.89e9, 5.9e9};
+    Spectrum spectrum(freqs);
+    auto dz_vec = makeConvoy(10);
+    auto invSqrtWavelengths = VehicleObstacleControl::getInvSqrtWavelengths(spectrum);
+    std::vector<double> values(spectrum.getNumFreqs());
+
+    BENCHMARK("getVehicleAttenuationDZ")
+    {
+        return VehicleObstacleControl::getVehicleAttenuationDZ(dz_vec, Signal(spectrum)).at(0);
+    };
+
+    BENCHMARK("attenuateByVehicles")
+    {
+        std::fill(values.begin(), values.end(), 1.0);
+        VehicleObstacleControl::attenuateByVehicles(dz_vec, invSqrtWavelengths, values.data());
+        return values[0];
+    };
+}
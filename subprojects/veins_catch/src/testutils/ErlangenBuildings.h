@@ -0,0 +1,91 @@
+//
+// Copyright (C) 2026 Veins contributors
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "veins/modules/obstacle/Obstacle.h"
+
+namespace veins {
+
+/**
+ * Load the building outlines of the Erlangen example scenario (from a SUMO poly file), as real-world test data.
+ *
+ * Coordinates are shifted so the buildings start at (0, 0), like in a simulation's playground.
+ * Returns an empty list if the file cannot be found.
+ */
+inline std::vector<Obstacle> loadErlangenBuildings()
+{
+    // tests may be run from the veins root, subprojects/veins_catch, or its src directory
+    std::ifstream in;
+    for (std::string prefix : {"", "../", "../../", "../../../"}) {
+        in.open(prefix + "examples/veins/erlangen.poly.xml");
+        if (in) break;
+        in.clear();
+    }
+    std::vector<Obstacle> obstacles;
+    if (!in) return obstacles;
+
+    std::vector<Obstacle::Coords> shapes;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find("<poly ") == std::string::npos || line.find("type=\"building\"") == std::string::npos) continue;
+        size_t begin = line.find("shape=\"");
+        if (begin == std::string::npos) continue;
+        begin += 7;
+        size_t end = line.find('"', begin);
+        std::istringstream shapeStream(line.substr(begin, end - begin));
+        Obstacle::Coords shape;
+        std::string xy;
+        while (shapeStream >> xy) {
+            size_t comma = xy.find(',');
+            shape.emplace_back(std::stod(xy.substr(0, comma)), std::stod(xy.substr(comma + 1)));
+        }
+        shapes.push_back(shape);
+    }
+
+    Coord offset(std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+    for (const auto& shape : shapes) {
+        for (const auto& c : shape) {
+            offset.x = std::min(offset.x, c.x);
+            offset.y = std::min(offset.y, c.y);
+        }
+    }
+    for (auto& shape : shapes) {
+        for (auto& c : shape) {
+            c.x -= offset.x;
+            c.y -= offset.y;
+        }
+        Obstacle obstacle("building#" + std::to_string(obstacles.size()), "building", 9, 0.4);
+        obstacle.setShape(shape);
+        obstacles.push_back(obstacle);
+    }
+    return obstacles;
+}
+
+} // namespace veins